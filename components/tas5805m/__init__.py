@@ -0,0 +1,27 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import CONF_ID
+
+from .audio_dac import Tas5805mComponent, Tas5805mGroup
+
+CODEOWNERS = ["@mrtoy-me"]
+MULTI_CONF = True
+
+CONF_AMPS = "amps"
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(Tas5805mGroup),
+        cv.Required(CONF_AMPS): cv.All(
+            cv.ensure_list(cv.use_id(Tas5805mComponent)), cv.Length(min=2, max=4)
+        ),
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    for amp_id in config[CONF_AMPS]:
+        amp = await cg.get_variable(amp_id)
+        cg.add(var.add_amp(amp))
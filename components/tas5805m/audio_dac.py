@@ -1,28 +1,59 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
+import esphome.final_validate as fv
 from esphome.components import i2c
 from esphome.components.audio_dac import AudioDac
-from esphome import pins
+from esphome import automation, pins
 
 from esphome.const import (
+    CONF_AUDIO_DAC,
+    CONF_BITS_PER_SAMPLE,
+    CONF_DURATION,
     CONF_ID,
     CONF_ENABLE_PIN,
+    CONF_VOLUME,
 )
 
 CODEOWNERS = ["@mrtoy-me"]
 DEPENDENCIES = ["i2c"]
 
 CONF_ANALOG_GAIN = "analog_gain"
+CONF_ATTACK = "attack"
 CONF_DAC_MODE = "dac_mode"
+CONF_FAULT_PIN = "fault_pin"
+CONF_FAULT_POLL_MAX_INTERVAL = "fault_poll_max_interval"
+CONF_FAULT_POLL_MIN_INTERVAL = "fault_poll_min_interval"
+CONF_FAULT_RECOVERY_BACKOFF = "fault_recovery_backoff"
+CONF_FAULT_RECOVERY_MAX_RETRIES = "fault_recovery_max_retries"
+CONF_FAULT_RECOVERY_WINDOW = "fault_recovery_window"
+CONF_I2S_FORMAT = "i2s_format"
+CONF_IDLE_DEEP_SLEEP_TIMEOUT = "idle_deep_sleep_timeout"
+CONF_IDLE_HI_Z_TIMEOUT = "idle_hi_z_timeout"
+CONF_IDLE_LEVEL_THRESHOLD = "idle_level_threshold"
 CONF_IGNORE_FAULT = "ignore_fault"
+CONF_LEVEL = "level"
+CONF_LEVEL_METER_INTERVAL = "level_meter_interval"
 CONF_MIXER_MODE = "mixer_mode"
+CONF_MODULATION_MODE = "modulation_mode"
+CONF_PIPELINE_LATENCY = "pipeline_latency"
 CONF_REFRESH_EQ = "refresh_eq"
+CONF_SWITCHING_FREQUENCY = "switching_frequency"
+CONF_TDM_SLOT = "tdm_slot"
+CONF_THERMAL_FOLDBACK_HOLD = "thermal_foldback_hold"
+CONF_THERMAL_FOLDBACK_INTERVAL = "thermal_foldback_interval"
+CONF_THERMAL_FOLDBACK_MAX = "thermal_foldback_max"
+CONF_THERMAL_FOLDBACK_STEP = "thermal_foldback_step"
+CONF_RELEASE = "release"
+CONF_VOLUME_RAMP_RATE = "volume_ramp_rate"
+CONF_VOLUME_RAMP_STEP = "volume_ramp_step"
+CONF_WORD_LENGTH = "word_length"
 CONF_VOLUME_MIN = "volume_min"
 CONF_VOLUME_MAX = "volume_max"
 CONF_TAS5805M_ID = "tas5805m_id"
 
 tas5805m_ns = cg.esphome_ns.namespace("tas5805m")
 Tas5805mComponent = tas5805m_ns.class_("Tas5805mComponent", AudioDac, cg.PollingComponent, i2c.I2CDevice)
+Tas5805mGroup = tas5805m_ns.class_("Tas5805mGroup", AudioDac, cg.Component)
 
 AutoRefreshMode = tas5805m_ns.enum("AutoRefreshMode")
 AUTO_REFRESH_MODES = {
@@ -36,11 +67,63 @@ DAC_MODES = {
     "PBTL": DacMode.PBTL,
 }
 
+ModulationMode = tas5805m_ns.enum("ModulationMode")
+MODULATION_MODES = {
+    "BD"    : ModulationMode.MOD_BD,
+    "1SPW"  : ModulationMode.MOD_1SPW,
+    "HYBRID": ModulationMode.MOD_HYBRID,
+}
+
+SwitchingFrequency = tas5805m_ns.enum("SwitchingFrequency")
+SWITCHING_FREQUENCIES = {
+    384000.0: SwitchingFrequency.FSW_384KHZ,
+    480000.0: SwitchingFrequency.FSW_480KHZ,
+    576000.0: SwitchingFrequency.FSW_576KHZ,
+    768000.0: SwitchingFrequency.FSW_768KHZ,
+}
+
+SerialFormat = tas5805m_ns.enum("SerialFormat")
+SERIAL_FORMATS = {
+    "I2S": SerialFormat.FORMAT_I2S,
+    "TDM": SerialFormat.FORMAT_TDM,
+    "RJ" : SerialFormat.FORMAT_RJ,
+    "LJ" : SerialFormat.FORMAT_LJ,
+}
+
+WordLength = tas5805m_ns.enum("WordLength")
+WORD_LENGTHS = {
+    16: WordLength.WORD_LENGTH_16,
+    24: WordLength.WORD_LENGTH_24,
+    32: WordLength.WORD_LENGTH_32,
+}
+
 ExcludeIgnoreMode = tas5805m_ns.enum("ExcludeIgnoreModes")
 EXCLUDE_IGNORE_MODES = {
      "NONE"        : ExcludeIgnoreMode.NONE,
      "CLOCK_FAULT" : ExcludeIgnoreMode.CLOCK_FAULT,
 }
+VolumeRampRate = tas5805m_ns.enum("VolumeRampRate")
+VOLUME_RAMP_RATES = {
+    "1FS"    : VolumeRampRate.RAMP_RATE_1FS,
+    "2FS"    : VolumeRampRate.RAMP_RATE_2FS,
+    "4FS"    : VolumeRampRate.RAMP_RATE_4FS,
+    "INSTANT": VolumeRampRate.RAMP_RATE_INSTANT,
+}
+
+VolumeRampStep = tas5805m_ns.enum("VolumeRampStep")
+VOLUME_RAMP_STEPS = {
+    0.5: VolumeRampStep.RAMP_STEP_0_5DB,
+    1  : VolumeRampStep.RAMP_STEP_1DB,
+    2  : VolumeRampStep.RAMP_STEP_2DB,
+    4  : VolumeRampStep.RAMP_STEP_4DB,
+}
+
+FadeToAction = tas5805m_ns.class_("FadeToAction", automation.Action)
+DuckAction = tas5805m_ns.class_("DuckAction", automation.Action)
+UnduckAction = tas5805m_ns.class_("UnduckAction", automation.Action)
+DumpFaultEventsAction = tas5805m_ns.class_("DumpFaultEventsAction", automation.Action)
+ClearFaultEventsAction = tas5805m_ns.class_("ClearFaultEventsAction", automation.Action)
+
 MixerMode = tas5805m_ns.enum("MixerMode")
 MIXER_MODES = {
     "STEREO"         : MixerMode.STEREO,
@@ -56,27 +139,128 @@ ANALOG_GAINS = [-15.5, -15, -14.5, -14, -13.5, -13, -12.5, -12, -11.5, -11, -10.
 def validate_config(config):
     if config[CONF_DAC_MODE] == "PBTL" and (config[CONF_MIXER_MODE] == "STEREO" or config[CONF_MIXER_MODE] == "STEREO_INVERSE"):
         raise cv.Invalid("dac_mode: PBTL must have mixer_mode: MONO or RIGHT or LEFT")
+    if (CONF_IDLE_HI_Z_TIMEOUT in config) and (CONF_IDLE_DEEP_SLEEP_TIMEOUT in config):
+        if config[CONF_IDLE_DEEP_SLEEP_TIMEOUT] <= config[CONF_IDLE_HI_Z_TIMEOUT]:
+            raise cv.Invalid("idle_deep_sleep_timeout must be greater than idle_hi_z_timeout")
+    if (CONF_FAULT_POLL_MAX_INTERVAL in config) and (config[CONF_FAULT_POLL_MAX_INTERVAL] < config[CONF_FAULT_POLL_MIN_INTERVAL]):
+        raise cv.Invalid("fault_poll_max_interval must not be less than fault_poll_min_interval")
+    if config[CONF_TDM_SLOT] != 0 and config[CONF_I2S_FORMAT] != "TDM":
+        raise cv.Invalid("tdm_slot requires i2s_format: TDM")
     if (config[CONF_VOLUME_MAX] - config[CONF_VOLUME_MIN]) < 9:
         raise cv.Invalid("volume_max must at least 9db greater than volume_min")
     return config
 
+# speakers using this tas5805m, directly or through a tas5805m amplifier group
+def _speakers_using_tas5805m(full_config, tas5805m_id):
+    dac_ids = {tas5805m_id}
+    for group in full_config.get("tas5805m", []):
+        if tas5805m_id in group["amps"]:
+            dac_ids.add(group[CONF_ID])
+    return [
+        speaker for speaker in full_config.get("speaker", [])
+        if speaker.get(CONF_AUDIO_DAC) in dac_ids
+    ]
+
+# the TAS5805M reads 'word_length' msb first from each sample slot so the speaker must send
+# at least that many bits, right justified and TDM also need an exact match to find the next sample
+def final_validate_word_length(config):
+    word_length = config[CONF_WORD_LENGTH]
+    i2s_format = config[CONF_I2S_FORMAT]
+    for speaker in _speakers_using_tas5805m(fv.full_config.get(), config[CONF_ID]):
+        if CONF_BITS_PER_SAMPLE not in speaker:
+            continue
+        bits_per_sample = int(speaker[CONF_BITS_PER_SAMPLE])
+        if i2s_format in ("RJ", "TDM"):
+            if word_length != bits_per_sample:
+                raise cv.Invalid(
+                    f"word_length {word_length} must equal speaker bits_per_sample {bits_per_sample} "
+                    f"with i2s_format: {i2s_format}"
+                )
+        elif word_length > bits_per_sample:
+            raise cv.Invalid(
+                f"word_length {word_length} must not be greater than speaker bits_per_sample {bits_per_sample}"
+            )
+    return config
+
+FINAL_VALIDATE_SCHEMA = final_validate_word_length
+
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
             cv.GenerateID(): cv.declare_id(Tas5805mComponent),
             cv.Required(CONF_ENABLE_PIN): pins.gpio_output_pin_schema,
+            cv.Optional(CONF_FAULT_PIN): pins.internal_gpio_input_pullup_pin_schema,
+            cv.Optional(CONF_FAULT_POLL_MAX_INTERVAL): cv.All(
+                        cv.positive_time_period_milliseconds,
+                        cv.Range(min=cv.TimePeriod(seconds=1), max=cv.TimePeriod(minutes=10)),
+            ),
+            cv.Optional(CONF_FAULT_POLL_MIN_INTERVAL, default="250ms"): cv.All(
+                        cv.positive_time_period_milliseconds,
+                        cv.Range(min=cv.TimePeriod(milliseconds=50), max=cv.TimePeriod(seconds=10)),
+            ),
+            cv.Optional(CONF_FAULT_RECOVERY_BACKOFF, default="1s"): cv.All(
+                        cv.positive_time_period_milliseconds,
+                        cv.Range(min=cv.TimePeriod(milliseconds=100), max=cv.TimePeriod(seconds=60)),
+            ),
+            cv.Optional(CONF_FAULT_RECOVERY_MAX_RETRIES, default=3): cv.int_range(min=1, max=10),
+            cv.Optional(CONF_FAULT_RECOVERY_WINDOW, default="60s"): cv.All(
+                        cv.positive_time_period_milliseconds,
+                        cv.Range(min=cv.TimePeriod(seconds=10), max=cv.TimePeriod(hours=24)),
+            ),
             cv.Optional(CONF_ANALOG_GAIN, default="-15.5dB"): cv.All(
                         cv.decibel, cv.one_of(*ANALOG_GAINS)
             ),
             cv.Optional(CONF_DAC_MODE, default="BTL"): cv.enum(
                         DAC_MODES, upper=True
             ),
+            cv.Optional(CONF_I2S_FORMAT, default="I2S"): cv.enum(
+                        SERIAL_FORMATS, upper=True
+            ),
+            cv.Optional(CONF_IDLE_HI_Z_TIMEOUT): cv.All(
+                        cv.positive_time_period_milliseconds,
+                        cv.Range(min=cv.TimePeriod(seconds=5)),
+            ),
+            cv.Optional(CONF_IDLE_DEEP_SLEEP_TIMEOUT): cv.All(
+                        cv.positive_time_period_milliseconds,
+                        cv.Range(min=cv.TimePeriod(seconds=5)),
+            ),
+            cv.Optional(CONF_IDLE_LEVEL_THRESHOLD, default="-70dB"): cv.All(
+                        cv.decibel, cv.float_range(min=-120, max=0)
+            ),
             cv.Optional(CONF_IGNORE_FAULT, default="CLOCK_FAULT"): cv.enum(
                         EXCLUDE_IGNORE_MODES, upper=True
             ),
+            cv.Optional(CONF_LEVEL_METER_INTERVAL, default="50ms"): cv.All(
+                        cv.positive_time_period_milliseconds,
+                        cv.Range(min=cv.TimePeriod(milliseconds=20), max=cv.TimePeriod(seconds=60)),
+            ),
             cv.Optional(CONF_MIXER_MODE, default="STEREO"): cv.enum(
                         MIXER_MODES, upper=True
             ),
+            cv.Optional(CONF_MODULATION_MODE, default="BD"): cv.enum(
+                        MODULATION_MODES, upper=True
+            ),
+            # samples at the detected sample rate, not given in the datasheet so measure for accuracy
+            cv.Optional(CONF_PIPELINE_LATENCY, default=48): cv.int_range(min=0, max=1024),
+            cv.Optional(CONF_SWITCHING_FREQUENCY, default="768kHz"): cv.All(
+                        cv.frequency, cv.one_of(*SWITCHING_FREQUENCIES)
+            ),
+            # left channel slot, right channel uses the next slot of a 16 slot frame
+            cv.Optional(CONF_TDM_SLOT, default=0): cv.int_range(min=0, max=14),
+            cv.Optional(CONF_THERMAL_FOLDBACK_HOLD, default="60s"): cv.All(
+                        cv.positive_time_period_milliseconds,
+                        cv.Range(min=cv.TimePeriod(seconds=1), max=cv.TimePeriod(minutes=60)),
+            ),
+            cv.Optional(CONF_THERMAL_FOLDBACK_INTERVAL, default="10s"): cv.All(
+                        cv.positive_time_period_milliseconds,
+                        cv.Range(min=cv.TimePeriod(seconds=1), max=cv.TimePeriod(minutes=10)),
+            ),
+            cv.Optional(CONF_THERMAL_FOLDBACK_MAX, default="12dB"): cv.All(
+                        cv.decibel, cv.float_range(min=0, max=40)
+            ),
+            cv.Optional(CONF_THERMAL_FOLDBACK_STEP, default="3dB"): cv.All(
+                        cv.decibel, cv.float_range(min=0, max=12)
+            ),
             cv.Optional(CONF_REFRESH_EQ, default="BY_GAIN"): cv.enum(
                         AUTO_REFRESH_MODES, upper=True
             ),
@@ -86,6 +270,13 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_VOLUME_MIN, default="-103dB"): cv.All(
                         cv.decibel, cv.int_range(-103, 24)
             ),
+            cv.Optional(CONF_VOLUME_RAMP_RATE, default="1FS"): cv.enum(
+                        VOLUME_RAMP_RATES, upper=True
+            ),
+            cv.Optional(CONF_VOLUME_RAMP_STEP, default="0.5dB"): cv.All(
+                        cv.decibel, cv.one_of(*VOLUME_RAMP_STEPS)
+            ),
+            cv.Optional(CONF_WORD_LENGTH, default=24): cv.enum(WORD_LENGTHS, int=True),
         }
     )
     .extend(cv.polling_component_schema("1s"))
@@ -100,10 +291,132 @@ async def to_code(config):
     await i2c.register_i2c_device(var, config)
     enable = await cg.gpio_pin_expression(config[CONF_ENABLE_PIN])
     cg.add(var.set_enable_pin(enable))
+    if fault_pin := config.get(CONF_FAULT_PIN):
+        fault = await cg.gpio_pin_expression(fault_pin)
+        cg.add(var.set_fault_pin(fault))
+    # with a fault pin, polling is only a slow safety net
+    if CONF_FAULT_POLL_MAX_INTERVAL in config:
+        fault_poll_max_interval = config[CONF_FAULT_POLL_MAX_INTERVAL].total_milliseconds
+    else:
+        fault_poll_max_interval = 60000 if CONF_FAULT_PIN in config else 10000
+    cg.add(var.config_fault_poll_interval(config[CONF_FAULT_POLL_MIN_INTERVAL], fault_poll_max_interval))
+    cg.add(var.config_fault_recovery(config[CONF_FAULT_RECOVERY_BACKOFF], config[CONF_FAULT_RECOVERY_MAX_RETRIES],
+                                     config[CONF_FAULT_RECOVERY_WINDOW]))
     cg.add(var.config_analog_gain(config[CONF_ANALOG_GAIN]))
     cg.add(var.config_dac_mode(config[CONF_DAC_MODE]))
+    cg.add(var.config_serial_audio_port(config[CONF_I2S_FORMAT], config[CONF_WORD_LENGTH], config[CONF_TDM_SLOT]))
     cg.add(var.config_ignore_fault_mode(config[CONF_IGNORE_FAULT]))
+    cg.add(var.config_level_meter_interval(config[CONF_LEVEL_METER_INTERVAL]))
     cg.add(var.config_mixer_mode(config[CONF_MIXER_MODE]))
+    cg.add(var.config_modulation_mode(config[CONF_MODULATION_MODE]))
+    cg.add(var.config_pipeline_latency(config[CONF_PIPELINE_LATENCY]))
+    cg.add(var.config_switching_frequency(SWITCHING_FREQUENCIES[config[CONF_SWITCHING_FREQUENCY]]))
+    if idle_hi_z_timeout := config.get(CONF_IDLE_HI_Z_TIMEOUT):
+        cg.add(var.config_idle_hi_z_timeout(idle_hi_z_timeout))
+    if idle_deep_sleep_timeout := config.get(CONF_IDLE_DEEP_SLEEP_TIMEOUT):
+        cg.add(var.config_idle_deep_sleep_timeout(idle_deep_sleep_timeout))
+    cg.add(var.config_idle_level_threshold(config[CONF_IDLE_LEVEL_THRESHOLD]))
     cg.add(var.config_refresh_eq(config[CONF_REFRESH_EQ]))
+    cg.add(var.config_thermal_foldback(config[CONF_THERMAL_FOLDBACK_STEP], config[CONF_THERMAL_FOLDBACK_MAX],
+                                       config[CONF_THERMAL_FOLDBACK_INTERVAL], config[CONF_THERMAL_FOLDBACK_HOLD]))
     cg.add(var.config_volume_max(config[CONF_VOLUME_MAX]))
     cg.add(var.config_volume_min(config[CONF_VOLUME_MIN]))
+    cg.add(var.config_volume_ramp(config[CONF_VOLUME_RAMP_RATE], VOLUME_RAMP_STEPS[config[CONF_VOLUME_RAMP_STEP]]))
+
+
+# volume actions accept a tas5805m or an amplifier group, the action is built for the type of its target
+async def new_volume_action(config, action_id, template_arg):
+    full_id, parent = await cg.get_variable_with_full_id(config[CONF_ID])
+    if full_id.type.inherits_from(Tas5805mGroup):
+        parent_type = Tas5805mGroup
+    elif full_id.type.inherits_from(Tas5805mComponent):
+        parent_type = Tas5805mComponent
+    else:
+        raise cv.Invalid(f"{full_id.id} is not a tas5805m or a tas5805m amplifier group")
+    var = cg.new_Pvariable(action_id, cg.TemplateArguments(parent_type, *template_arg))
+    await cg.register_parented(var, parent)
+    return var
+
+
+FADE_TO_ACTION_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.use_id(AudioDac),
+        cv.Required(CONF_VOLUME): cv.templatable(cv.percentage),
+        cv.Optional(CONF_DURATION, default="1s"): cv.templatable(
+                    cv.positive_time_period_milliseconds
+        ),
+    }
+)
+
+@automation.register_action("tas5805m.fade_to", FadeToAction, FADE_TO_ACTION_SCHEMA)
+async def tas5805m_fade_to_to_code(config, action_id, template_arg, args):
+    var = await new_volume_action(config, action_id, template_arg)
+    template_ = await cg.templatable(config[CONF_VOLUME], args, float)
+    cg.add(var.set_volume(template_))
+    template_ = await cg.templatable(config[CONF_DURATION], args, cg.uint32)
+    cg.add(var.set_duration(template_))
+    return var
+
+
+DUCK_ACTION_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.use_id(AudioDac),
+        cv.Optional(CONF_LEVEL, default="-20dB"): cv.templatable(
+                    cv.All(cv.decibel, cv.float_range(min=-103.0, max=0.0))
+        ),
+        cv.Optional(CONF_ATTACK, default="200ms"): cv.templatable(
+                    cv.positive_time_period_milliseconds
+        ),
+        cv.Optional(CONF_RELEASE, default="1s"): cv.templatable(
+                    cv.positive_time_period_milliseconds
+        ),
+        cv.Optional(CONF_DURATION, default="0ms"): cv.templatable(
+                    cv.positive_time_period_milliseconds
+        ),
+    }
+)
+
+@automation.register_action("tas5805m.duck", DuckAction, DUCK_ACTION_SCHEMA)
+async def tas5805m_duck_to_code(config, action_id, template_arg, args):
+    var = await new_volume_action(config, action_id, template_arg)
+    template_ = await cg.templatable(config[CONF_LEVEL], args, float)
+    cg.add(var.set_level(template_))
+    template_ = await cg.templatable(config[CONF_ATTACK], args, cg.uint32)
+    cg.add(var.set_attack(template_))
+    template_ = await cg.templatable(config[CONF_RELEASE], args, cg.uint32)
+    cg.add(var.set_release(template_))
+    template_ = await cg.templatable(config[CONF_DURATION], args, cg.uint32)
+    cg.add(var.set_duration(template_))
+    return var
+
+
+UNDUCK_ACTION_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.use_id(AudioDac),
+    }
+)
+
+@automation.register_action("tas5805m.unduck", UnduckAction, UNDUCK_ACTION_SCHEMA)
+async def tas5805m_unduck_to_code(config, action_id, template_arg, args):
+    var = await new_volume_action(config, action_id, template_arg)
+    return var
+
+
+FAULT_EVENTS_ACTION_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.use_id(Tas5805mComponent),
+    }
+)
+
+@automation.register_action("tas5805m.dump_fault_events", DumpFaultEventsAction, FAULT_EVENTS_ACTION_SCHEMA)
+async def tas5805m_dump_fault_events_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
+
+
+@automation.register_action("tas5805m.clear_fault_events", ClearFaultEventsAction, FAULT_EVENTS_ACTION_SCHEMA)
+async def tas5805m_clear_fault_events_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "esphome/core/automation.h"
+#include "esphome/core/component.h"
+#include "tas5805m.h"
+#include "tas5805m_group.h"
+
+namespace esphome::tas5805m {
+
+// volume actions target either a tas5805m or an amplifier group, 'T' is the type of the target
+template<typename T, typename... Ts> class FadeToAction : public Action<Ts...>, public Parented<T> {
+ public:
+  TEMPLATABLE_VALUE(float, volume)
+  TEMPLATABLE_VALUE(uint32_t, duration)
+
+  void play(Ts... x) override { this->parent_->fade_to(this->volume_.value(x...), this->duration_.value(x...)); }
+};
+
+template<typename T, typename... Ts> class DuckAction : public Action<Ts...>, public Parented<T> {
+ public:
+  TEMPLATABLE_VALUE(float, level)
+  TEMPLATABLE_VALUE(uint32_t, attack)
+  TEMPLATABLE_VALUE(uint32_t, release)
+  TEMPLATABLE_VALUE(uint32_t, duration)
+
+  void play(Ts... x) override {
+    this->parent_->duck(this->level_.value(x...), this->attack_.value(x...), this->release_.value(x...),
+                        this->duration_.value(x...));
+  }
+};
+
+template<typename T, typename... Ts> class UnduckAction : public Action<Ts...>, public Parented<T> {
+ public:
+  void play(Ts... x) override { this->parent_->unduck(); }
+};
+
+template<typename... Ts> class DumpFaultEventsAction : public Action<Ts...>, public Parented<Tas5805mComponent> {
+ public:
+  void play(Ts... x) override { this->parent_->dump_fault_events(); }
+};
+
+template<typename... Ts> class ClearFaultEventsAction : public Action<Ts...>, public Parented<Tas5805mComponent> {
+ public:
+  void play(Ts... x) override { this->parent_->clear_fault_events(); }
+};
+
+}  // namespace esphome::tas5805m
@@ -5,8 +5,18 @@ from esphome.const import (
     DEVICE_CLASS_SOUND_PRESSURE,
     ENTITY_CATEGORY_CONFIG,
     UNIT_DECIBEL,
+    UNIT_PERCENT,
 )
 
+CONF_ANALOG_GAIN = "analog_gain"
+CONF_BALANCE = "balance"
+CONF_LEFT_CHANNEL_VOLUME = "left_channel_volume"
+CONF_RIGHT_CHANNEL_VOLUME = "right_channel_volume"
+CONF_LEFT_TO_LEFT_GAIN = "left_to_left_gain"
+CONF_RIGHT_TO_LEFT_GAIN = "right_to_left_gain"
+CONF_LEFT_TO_RIGHT_GAIN = "left_to_right_gain"
+CONF_RIGHT_TO_RIGHT_GAIN = "right_to_right_gain"
+
 CONF_GAIN_20HZ = "eq_gain_band20Hz"
 CONF_GAIN_31P5HZ = "eq_gain_band31.5Hz"
 CONF_GAIN_50HZ = "eq_gain_band50Hz"
@@ -24,6 +34,12 @@ CONF_GAIN_8000HZ = "eq_gain_band8000Hz"
 CONF_GAIN_16000HZ = "eq_gain_band16000Hz"
 
 ICON_VOLUME_SOURCE = "mdi:volume-source"
+ICON_PAN_HORIZONTAL = "mdi:pan-horizontal"
+ICON_SPEAKER_MULTIPLE = "mdi:speaker-multiple"
+
+# eq gain numbers are all required or none configured
+EQ_GAINS_GROUP = "eq_gains"
+EQ_GAINS_MESSAGE = "all 15 eq gain bands must be configured"
 
 from ..audio_dac import CONF_TAS5805M_ID, Tas5805mComponent, tas5805m_ns
 
@@ -42,12 +58,32 @@ EqGainBand3150hz = tas5805m_ns.class_("EqGainBand3150hz", number.Number, cg.Comp
 EqGainBand5000hz = tas5805m_ns.class_("EqGainBand5000hz", number.Number, cg.Component)
 EqGainBand8000hz = tas5805m_ns.class_("EqGainBand8000hz", number.Number, cg.Component)
 EqGainBand16000hz = tas5805m_ns.class_("EqGainBand16000hz", number.Number, cg.Component)
+AnalogGainNumber = tas5805m_ns.class_("AnalogGainNumber", number.Number, cg.Component)
+BalanceNumber = tas5805m_ns.class_("BalanceNumber", number.Number, cg.Component)
+ChannelVolumeNumber = tas5805m_ns.class_("ChannelVolumeNumber", number.Number, cg.Component)
+MixerGainNumber = tas5805m_ns.class_("MixerGainNumber", number.Number, cg.Component)
+
+MixerPath = tas5805m_ns.enum("MixerPath")
+MIXER_GAIN_PATHS = {
+    CONF_LEFT_TO_LEFT_GAIN   : MixerPath.MIXER_LEFT_TO_LEFT,
+    CONF_RIGHT_TO_LEFT_GAIN  : MixerPath.MIXER_RIGHT_TO_LEFT,
+    CONF_LEFT_TO_RIGHT_GAIN  : MixerPath.MIXER_LEFT_TO_RIGHT,
+    CONF_RIGHT_TO_RIGHT_GAIN : MixerPath.MIXER_RIGHT_TO_RIGHT,
+}
+
+MIXER_GAIN_SCHEMA = number.number_schema(
+    MixerGainNumber,
+    device_class=DEVICE_CLASS_SOUND_PRESSURE,
+    entity_category=ENTITY_CATEGORY_CONFIG,
+    icon=ICON_SPEAKER_MULTIPLE,
+    unit_of_measurement=UNIT_DECIBEL,
+).extend(cv.COMPONENT_SCHEMA)
 
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(CONF_TAS5805M_ID): cv.use_id(Tas5805mComponent),
 
-        cv.Required(CONF_GAIN_20HZ): number.number_schema(
+        cv.Inclusive(CONF_GAIN_20HZ, EQ_GAINS_GROUP, msg=EQ_GAINS_MESSAGE): number.number_schema(
             EqGainBand20hz,
             device_class=DEVICE_CLASS_SOUND_PRESSURE,
             entity_category=ENTITY_CATEGORY_CONFIG,
@@ -56,7 +92,7 @@ CONFIG_SCHEMA = cv.Schema(
         )
         .extend(cv.COMPONENT_SCHEMA),
 
-        cv.Required(CONF_GAIN_31P5HZ): number.number_schema(
+        cv.Inclusive(CONF_GAIN_31P5HZ, EQ_GAINS_GROUP, msg=EQ_GAINS_MESSAGE): number.number_schema(
             EqGainBand31p5hz,
             device_class=DEVICE_CLASS_SOUND_PRESSURE,
             entity_category=ENTITY_CATEGORY_CONFIG,
@@ -65,7 +101,7 @@ CONFIG_SCHEMA = cv.Schema(
         )
         .extend(cv.COMPONENT_SCHEMA),
 
-        cv.Required(CONF_GAIN_50HZ): number.number_schema(
+        cv.Inclusive(CONF_GAIN_50HZ, EQ_GAINS_GROUP, msg=EQ_GAINS_MESSAGE): number.number_schema(
             EqGainBand50hz,
             device_class=DEVICE_CLASS_SOUND_PRESSURE,
             entity_category=ENTITY_CATEGORY_CONFIG,
@@ -74,7 +110,7 @@ CONFIG_SCHEMA = cv.Schema(
         )
         .extend(cv.COMPONENT_SCHEMA),
 
-        cv.Required(CONF_GAIN_80HZ): number.number_schema(
+        cv.Inclusive(CONF_GAIN_80HZ, EQ_GAINS_GROUP, msg=EQ_GAINS_MESSAGE): number.number_schema(
             EqGainBand80hz,
             device_class=DEVICE_CLASS_SOUND_PRESSURE,
             entity_category=ENTITY_CATEGORY_CONFIG,
@@ -83,7 +119,7 @@ CONFIG_SCHEMA = cv.Schema(
         )
         .extend(cv.COMPONENT_SCHEMA),
 
-        cv.Required(CONF_GAIN_125HZ): number.number_schema(
+        cv.Inclusive(CONF_GAIN_125HZ, EQ_GAINS_GROUP, msg=EQ_GAINS_MESSAGE): number.number_schema(
             EqGainBand125hz,
             device_class=DEVICE_CLASS_SOUND_PRESSURE,
             entity_category=ENTITY_CATEGORY_CONFIG,
@@ -92,7 +128,7 @@ CONFIG_SCHEMA = cv.Schema(
         )
         .extend(cv.COMPONENT_SCHEMA),
 
-        cv.Required(CONF_GAIN_200HZ): number.number_schema(
+        cv.Inclusive(CONF_GAIN_200HZ, EQ_GAINS_GROUP, msg=EQ_GAINS_MESSAGE): number.number_schema(
             EqGainBand200hz,
             device_class=DEVICE_CLASS_SOUND_PRESSURE,
             entity_category=ENTITY_CATEGORY_CONFIG,
@@ -101,7 +137,7 @@ CONFIG_SCHEMA = cv.Schema(
         )
         .extend(cv.COMPONENT_SCHEMA),
 
-        cv.Required(CONF_GAIN_315HZ): number.number_schema(
+        cv.Inclusive(CONF_GAIN_315HZ, EQ_GAINS_GROUP, msg=EQ_GAINS_MESSAGE): number.number_schema(
             EqGainBand315hz,
             device_class=DEVICE_CLASS_SOUND_PRESSURE,
             entity_category=ENTITY_CATEGORY_CONFIG,
@@ -110,7 +146,7 @@ CONFIG_SCHEMA = cv.Schema(
         )
         .extend(cv.COMPONENT_SCHEMA),
 
-        cv.Required(CONF_GAIN_500HZ): number.number_schema(
+        cv.Inclusive(CONF_GAIN_500HZ, EQ_GAINS_GROUP, msg=EQ_GAINS_MESSAGE): number.number_schema(
             EqGainBand500hz,
             device_class=DEVICE_CLASS_SOUND_PRESSURE,
             entity_category=ENTITY_CATEGORY_CONFIG,
@@ -119,7 +155,7 @@ CONFIG_SCHEMA = cv.Schema(
         )
         .extend(cv.COMPONENT_SCHEMA),
 
-        cv.Required(CONF_GAIN_800HZ): number.number_schema(
+        cv.Inclusive(CONF_GAIN_800HZ, EQ_GAINS_GROUP, msg=EQ_GAINS_MESSAGE): number.number_schema(
             EqGainBand800hz,
             device_class=DEVICE_CLASS_SOUND_PRESSURE,
             entity_category=ENTITY_CATEGORY_CONFIG,
@@ -128,7 +164,7 @@ CONFIG_SCHEMA = cv.Schema(
         )
         .extend(cv.COMPONENT_SCHEMA),
 
-        cv.Required(CONF_GAIN_1250HZ): number.number_schema(
+        cv.Inclusive(CONF_GAIN_1250HZ, EQ_GAINS_GROUP, msg=EQ_GAINS_MESSAGE): number.number_schema(
             EqGainBand1250hz,
             device_class=DEVICE_CLASS_SOUND_PRESSURE,
             entity_category=ENTITY_CATEGORY_CONFIG,
@@ -137,7 +173,7 @@ CONFIG_SCHEMA = cv.Schema(
         )
         .extend(cv.COMPONENT_SCHEMA),
 
-        cv.Required(CONF_GAIN_2000HZ): number.number_schema(
+        cv.Inclusive(CONF_GAIN_2000HZ, EQ_GAINS_GROUP, msg=EQ_GAINS_MESSAGE): number.number_schema(
             EqGainBand2000hz,
             device_class=DEVICE_CLASS_SOUND_PRESSURE,
             entity_category=ENTITY_CATEGORY_CONFIG,
@@ -146,7 +182,7 @@ CONFIG_SCHEMA = cv.Schema(
         )
         .extend(cv.COMPONENT_SCHEMA),
 
-        cv.Required(CONF_GAIN_3150HZ): number.number_schema(
+        cv.Inclusive(CONF_GAIN_3150HZ, EQ_GAINS_GROUP, msg=EQ_GAINS_MESSAGE): number.number_schema(
             EqGainBand3150hz,
             device_class=DEVICE_CLASS_SOUND_PRESSURE,
             entity_category=ENTITY_CATEGORY_CONFIG,
@@ -155,7 +191,7 @@ CONFIG_SCHEMA = cv.Schema(
         )
         .extend(cv.COMPONENT_SCHEMA),
 
-        cv.Required(CONF_GAIN_5000HZ): number.number_schema(
+        cv.Inclusive(CONF_GAIN_5000HZ, EQ_GAINS_GROUP, msg=EQ_GAINS_MESSAGE): number.number_schema(
             EqGainBand5000hz,
             device_class=DEVICE_CLASS_SOUND_PRESSURE,
             entity_category=ENTITY_CATEGORY_CONFIG,
@@ -164,7 +200,7 @@ CONFIG_SCHEMA = cv.Schema(
         )
         .extend(cv.COMPONENT_SCHEMA),
 
-        cv.Required(CONF_GAIN_8000HZ): number.number_schema(
+        cv.Inclusive(CONF_GAIN_8000HZ, EQ_GAINS_GROUP, msg=EQ_GAINS_MESSAGE): number.number_schema(
             EqGainBand8000hz,
             device_class=DEVICE_CLASS_SOUND_PRESSURE,
             entity_category=ENTITY_CATEGORY_CONFIG,
@@ -173,7 +209,7 @@ CONFIG_SCHEMA = cv.Schema(
         )
         .extend(cv.COMPONENT_SCHEMA),
 
-        cv.Required(CONF_GAIN_16000HZ): number.number_schema(
+        cv.Inclusive(CONF_GAIN_16000HZ, EQ_GAINS_GROUP, msg=EQ_GAINS_MESSAGE): number.number_schema(
             EqGainBand16000hz,
             device_class=DEVICE_CLASS_SOUND_PRESSURE,
             entity_category=ENTITY_CATEGORY_CONFIG,
@@ -181,18 +217,59 @@ CONFIG_SCHEMA = cv.Schema(
             unit_of_measurement=UNIT_DECIBEL,
         )
         .extend(cv.COMPONENT_SCHEMA),
+
+        cv.Optional(CONF_ANALOG_GAIN): number.number_schema(
+            AnalogGainNumber,
+            device_class=DEVICE_CLASS_SOUND_PRESSURE,
+            entity_category=ENTITY_CATEGORY_CONFIG,
+            icon=ICON_VOLUME_SOURCE,
+            unit_of_measurement=UNIT_DECIBEL,
+        )
+        .extend(cv.COMPONENT_SCHEMA),
+
+        cv.Optional(CONF_BALANCE): number.number_schema(
+            BalanceNumber,
+            entity_category=ENTITY_CATEGORY_CONFIG,
+            icon=ICON_PAN_HORIZONTAL,
+            unit_of_measurement=UNIT_PERCENT,
+        )
+        .extend(cv.COMPONENT_SCHEMA),
+
+        cv.Optional(CONF_LEFT_CHANNEL_VOLUME): number.number_schema(
+            ChannelVolumeNumber,
+            device_class=DEVICE_CLASS_SOUND_PRESSURE,
+            entity_category=ENTITY_CATEGORY_CONFIG,
+            icon=ICON_VOLUME_SOURCE,
+            unit_of_measurement=UNIT_DECIBEL,
+        )
+        .extend(cv.COMPONENT_SCHEMA),
+
+        cv.Optional(CONF_RIGHT_CHANNEL_VOLUME): number.number_schema(
+            ChannelVolumeNumber,
+            device_class=DEVICE_CLASS_SOUND_PRESSURE,
+            entity_category=ENTITY_CATEGORY_CONFIG,
+            icon=ICON_VOLUME_SOURCE,
+            unit_of_measurement=UNIT_DECIBEL,
+        )
+        .extend(cv.COMPONENT_SCHEMA),
+
+        cv.Optional(CONF_LEFT_TO_LEFT_GAIN): MIXER_GAIN_SCHEMA,
+        cv.Optional(CONF_RIGHT_TO_LEFT_GAIN): MIXER_GAIN_SCHEMA,
+        cv.Optional(CONF_LEFT_TO_RIGHT_GAIN): MIXER_GAIN_SCHEMA,
+        cv.Optional(CONF_RIGHT_TO_RIGHT_GAIN): MIXER_GAIN_SCHEMA,
     }
 )
 
 async def to_code(config):
-    cg.add_define("USE_TAS5805M_EQ")
     tas5805m_component = await cg.get_variable(config[CONF_TAS5805M_ID])
-    gain_20hz_config = config.get(CONF_GAIN_20HZ)
-    n = await number.new_number(
-        gain_20hz_config, min_value=-15, max_value=15, step=1
-    )
-    await cg.register_component(n, gain_20hz_config)
-    await cg.register_parented(n, tas5805m_component)
+
+    if gain_20hz_config := config.get(CONF_GAIN_20HZ):
+        cg.add_define("USE_TAS5805M_EQ")
+        n = await number.new_number(
+            gain_20hz_config, min_value=-15, max_value=15, step=1
+        )
+        await cg.register_component(n, gain_20hz_config)
+        await cg.register_parented(n, tas5805m_component)
 
     if gain_31p5hz_config := config.get(CONF_GAIN_31P5HZ):
         n = await number.new_number(
@@ -292,3 +369,40 @@ async def to_code(config):
         )
         await cg.register_component(n, gain_16000hz_config)
         await cg.register_parented(n, tas5805m_component)
+
+    if analog_gain_config := config.get(CONF_ANALOG_GAIN):
+        n = await number.new_number(
+            analog_gain_config, min_value=-15.5, max_value=0, step=0.5
+        )
+        await cg.register_component(n, analog_gain_config)
+        await cg.register_parented(n, tas5805m_component)
+    if balance_config := config.get(CONF_BALANCE):
+        n = await number.new_number(
+            balance_config, min_value=-100, max_value=100, step=1
+        )
+        await cg.register_component(n, balance_config)
+        await cg.register_parented(n, tas5805m_component)
+
+    if left_volume_config := config.get(CONF_LEFT_CHANNEL_VOLUME):
+        n = await number.new_number(
+            left_volume_config, min_value=-30, max_value=6, step=0.1
+        )
+        await cg.register_component(n, left_volume_config)
+        await cg.register_parented(n, tas5805m_component)
+
+    if right_volume_config := config.get(CONF_RIGHT_CHANNEL_VOLUME):
+        n = await number.new_number(
+            right_volume_config, min_value=-30, max_value=6, step=0.1
+        )
+        await cg.register_component(n, right_volume_config)
+        await cg.register_parented(n, tas5805m_component)
+        cg.add(n.set_right_channel(True))
+
+    for conf_mixer_gain, mixer_path in MIXER_GAIN_PATHS.items():
+        if mixer_gain_config := config.get(conf_mixer_gain):
+            n = await number.new_number(
+                mixer_gain_config, min_value=-103, max_value=12, step=0.5
+            )
+            await cg.register_component(n, mixer_gain_config)
+            await cg.register_parented(n, tas5805m_component)
+            cg.add(n.set_mixer_path(mixer_path))
@@ -0,0 +1,32 @@
+#include "analog_gain_number.h"
+#include "esphome/core/log.h"
+
+namespace esphome::tas5805m {
+
+static const char *const TAG = "tas5805m.number";
+
+// number is -15.5dB to 0dB
+// without a saved value the YAML configured analog gain is used
+void AnalogGainNumber::setup() {
+  float value;
+  this->pref_ = global_preferences->make_preference<float>(this->get_object_id_hash());
+  if (this->pref_.load(&value)) {
+    this->parent_->set_analog_gain(value);
+  } else {
+    value = this->parent_->analog_gain();
+  }
+  this->publish_state(value);
+}
+
+void AnalogGainNumber::dump_config() {
+  ESP_LOGCONFIG(TAG, "Tas5805m Analog Gain Number:");
+  ESP_LOGCONFIG(TAG, "  Analog Gain '%s'", this->get_name().c_str());
+}
+
+void AnalogGainNumber::control(float value) {
+  this->publish_state(value);
+  this->parent_->set_analog_gain(value);
+  this->pref_.save(&value);
+}
+
+}  // namespace esphome::tas5805m
@@ -0,0 +1,36 @@
+#include "balance_number.h"
+#include "esphome/core/log.h"
+
+namespace esphome::tas5805m {
+
+static const char *const TAG = "tas5805m.number";
+
+// number is -100% (left only) to 100% (right only)
+void BalanceNumber::setup() {
+  float value;
+  this->pref_ = global_preferences->make_preference<float>(this->get_object_id_hash());
+  if (!this->pref_.load(&value)) value= 0.0;
+  this->publish_state(value);
+  this->parent_->set_balance(value / 100.0f);
+
+  // without eq gain numbers, dsp volume numbers trigger refresh of settings
+  // when YAML configured refresh_eq: BY_GAIN which is default
+  #ifndef USE_TAS5805M_EQ
+  if (this->parent_->use_eq_gain_refresh()) {
+    this->parent_->refresh_settings();
+  }
+  #endif
+}
+
+void BalanceNumber::dump_config() {
+  ESP_LOGCONFIG(TAG, "Tas5805m Balance Number:");
+  ESP_LOGCONFIG(TAG, "  Balance '%s'", this->get_name().c_str());
+}
+
+void BalanceNumber::control(float value) {
+  this->publish_state(value);
+  this->parent_->set_balance(value / 100.0f);
+  this->pref_.save(&value);
+}
+
+}  // namespace esphome::tas5805m
@@ -0,0 +1,43 @@
+#include "channel_volume_number.h"
+#include "esphome/core/log.h"
+
+namespace esphome::tas5805m {
+
+static const char *const TAG = "tas5805m.number";
+
+void ChannelVolumeNumber::setup() {
+  float value;
+  this->pref_ = global_preferences->make_preference<float>(this->get_object_id_hash());
+  if (!this->pref_.load(&value)) value= 0.0;
+  this->publish_state(value);
+  this->write_channel_volume_(value);
+
+  // without eq gain numbers, dsp volume numbers trigger refresh of settings
+  // when YAML configured refresh_eq: BY_GAIN which is default
+  #ifndef USE_TAS5805M_EQ
+  if (this->parent_->use_eq_gain_refresh()) {
+    this->parent_->refresh_settings();
+  }
+  #endif
+}
+
+void ChannelVolumeNumber::dump_config() {
+  ESP_LOGCONFIG(TAG, "Tas5805m Channel Volume Number:");
+  ESP_LOGCONFIG(TAG, "  %s Channel '%s'", this->right_channel_ ? "Right" : "Left", this->get_name().c_str());
+}
+
+void ChannelVolumeNumber::control(float value) {
+  this->publish_state(value);
+  this->write_channel_volume_(value);
+  this->pref_.save(&value);
+}
+
+void ChannelVolumeNumber::write_channel_volume_(float value) {
+  if (this->right_channel_) {
+    this->parent_->set_right_channel_volume(value);
+  } else {
+    this->parent_->set_left_channel_volume(value);
+  }
+}
+
+}  // namespace esphome::tas5805m
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "esphome/components/number/number.h"
+#include "esphome/core/component.h"
+#include "esphome/core/preferences.h"
+#include "../tas5805m.h"
+
+namespace esphome::tas5805m {
+
+class ChannelVolumeNumber : public number::Number, public Component, public Parented<Tas5805mComponent> {
+ public:
+  void setup() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::AFTER_CONNECTION; }
+
+  void set_right_channel(bool right_channel) { this->right_channel_ = right_channel; }
+
+ protected:
+  void control(float value) override;
+  void write_channel_volume_(float value);
+
+  ESPPreferenceObject pref_;
+
+  bool right_channel_{false};
+};
+
+}  // namespace esphome::tas5805m
@@ -0,0 +1,38 @@
+#include "mixer_gain_number.h"
+#include "esphome/core/log.h"
+
+namespace esphome::tas5805m {
+
+static const char *const TAG = "tas5805m.number";
+
+// number is -103dB (path muted) to 12dB
+// without a saved value the gain from the YAML configured mixer mode is used
+void MixerGainNumber::setup() {
+  float value;
+  this->pref_ = global_preferences->make_preference<float>(this->get_object_id_hash());
+  if (this->pref_.load(&value)) {
+    this->parent_->set_mixer_gain(this->path_, value, this->parent_->is_mixer_inverted(this->path_));
+  } else {
+    value = this->parent_->mixer_gain(this->path_);
+  }
+  this->publish_state(value);
+
+  // republish when the gain is changed by a mixer mode or other than by this number
+  this->parent_->add_on_mixer_callback([this]() {
+    float gain = this->parent_->mixer_gain(this->path_);
+    if (gain != this->state) this->publish_state(gain);
+  });
+}
+
+void MixerGainNumber::dump_config() {
+  ESP_LOGCONFIG(TAG, "Tas5805m Mixer Gain Number:");
+  ESP_LOGCONFIG(TAG, "  %s '%s'", MIXER_PATH_TEXT[this->path_], this->get_name().c_str());
+}
+
+void MixerGainNumber::control(float value) {
+  this->publish_state(value);
+  this->parent_->set_mixer_gain(this->path_, value, this->parent_->is_mixer_inverted(this->path_));
+  this->pref_.save(&value);
+}
+
+}  // namespace esphome::tas5805m
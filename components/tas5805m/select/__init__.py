@@ -0,0 +1,47 @@
+import esphome.codegen as cg
+from esphome.components import select
+import esphome.config_validation as cv
+from esphome.const import ENTITY_CATEGORY_CONFIG
+
+CONF_DAC_MODE = "dac_mode"
+CONF_MIXER_MODE = "mixer_mode"
+
+ICON_SPEAKER_MULTIPLE = "mdi:speaker-multiple"
+ICON_AMPLIFIER = "mdi:amplifier"
+
+from ..audio_dac import CONF_TAS5805M_ID, DAC_MODES, MIXER_MODES, Tas5805mComponent, tas5805m_ns
+
+DacModeSelect = tas5805m_ns.class_("DacModeSelect", select.Select, cg.Component)
+MixerModeSelect = tas5805m_ns.class_("MixerModeSelect", select.Select, cg.Component)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_TAS5805M_ID): cv.use_id(Tas5805mComponent),
+
+        cv.Optional(CONF_DAC_MODE): select.select_schema(
+            DacModeSelect,
+            entity_category=ENTITY_CATEGORY_CONFIG,
+            icon=ICON_AMPLIFIER,
+        )
+        .extend(cv.COMPONENT_SCHEMA),
+
+        cv.Optional(CONF_MIXER_MODE): select.select_schema(
+            MixerModeSelect,
+            entity_category=ENTITY_CATEGORY_CONFIG,
+            icon=ICON_SPEAKER_MULTIPLE,
+        )
+        .extend(cv.COMPONENT_SCHEMA),
+    }
+)
+
+async def to_code(config):
+  tas5805m_component = await cg.get_variable(config[CONF_TAS5805M_ID])
+  if dac_mode_config := config.get(CONF_DAC_MODE):
+    s = await select.new_select(dac_mode_config, options=list(DAC_MODES))
+    await cg.register_component(s, dac_mode_config)
+    await cg.register_parented(s, tas5805m_component)
+
+  if mixer_mode_config := config.get(CONF_MIXER_MODE):
+    s = await select.new_select(mixer_mode_config, options=list(MIXER_MODES))
+    await cg.register_component(s, mixer_mode_config)
+    await cg.register_parented(s, tas5805m_component)
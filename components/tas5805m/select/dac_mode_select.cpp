@@ -0,0 +1,39 @@
+#include "dac_mode_select.h"
+#include "esphome/core/log.h"
+
+namespace esphome::tas5805m {
+
+static const char *const TAG = "tas5805m.select";
+
+// select options are in 'DacMode' order so option index is the dac mode
+void DacModeSelect::setup() {
+  uint8_t index;
+  this->pref_ = global_preferences->make_preference<uint8_t>(this->get_object_id_hash());
+  if (!this->pref_.load(&index) || !this->parent_->set_dac_mode(static_cast<DacMode>(index))) {
+    // use YAML configured dac mode
+    index = this->parent_->dac_mode();
+  }
+  auto option = this->at(index);
+  if (option.has_value()) this->publish_state(option.value());
+}
+
+void DacModeSelect::dump_config() {
+  ESP_LOGCONFIG(TAG, "Tas5805m Select:");
+  LOG_SELECT("  ", "DAC Mode", this);
+}
+
+void DacModeSelect::control(const std::string &value) {
+  auto index = this->index_of(value);
+  if (!index.has_value()) return;
+
+  // PBTL is rejected if not valid for mixer mode, so republish current dac mode
+  uint8_t mode = index.value();
+  if (!this->parent_->set_dac_mode(static_cast<DacMode>(mode))) {
+    mode = this->parent_->dac_mode();
+  }
+  auto option = this->at(mode);
+  if (option.has_value()) this->publish_state(option.value());
+  this->pref_.save(&mode);
+}
+
+}  // namespace esphome::tas5805m
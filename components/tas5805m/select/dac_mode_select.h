@@ -0,0 +1,22 @@
+#pragma once
+
+#include "esphome/components/select/select.h"
+#include "esphome/core/component.h"
+#include "esphome/core/preferences.h"
+#include "../tas5805m.h"
+
+namespace esphome::tas5805m {
+
+class DacModeSelect : public select::Select, public Component, public Parented<Tas5805mComponent> {
+ public:
+  void setup() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::AFTER_CONNECTION; }
+
+ protected:
+  void control(const std::string &value) override;
+
+  ESPPreferenceObject pref_;
+};
+
+}  // namespace esphome::tas5805m
@@ -0,0 +1,45 @@
+#include "mixer_mode_select.h"
+#include "esphome/core/log.h"
+
+namespace esphome::tas5805m {
+
+static const char *const TAG = "tas5805m.select";
+
+// select options are in 'MixerMode' order so option index is the mixer mode
+void MixerModeSelect::setup() {
+  uint8_t index;
+  this->pref_ = global_preferences->make_preference<uint8_t>(this->get_object_id_hash());
+  if (!this->pref_.load(&index) || !this->parent_->set_mixer_mode(static_cast<MixerMode>(index))) {
+    // use YAML configured mixer mode
+    index = this->parent_->mixer_mode();
+  }
+  auto option = this->at(index);
+  if (option.has_value()) this->publish_state(option.value());
+
+  // republish when the mixer mode is changed other than by this select
+  this->parent_->add_on_mixer_callback([this]() {
+    auto option = this->at(this->parent_->mixer_mode());
+    if (option.has_value() && (option.value() != this->state)) this->publish_state(option.value());
+  });
+}
+
+void MixerModeSelect::dump_config() {
+  ESP_LOGCONFIG(TAG, "Tas5805m Select:");
+  LOG_SELECT("  ", "Mixer Mode", this);
+}
+
+void MixerModeSelect::control(const std::string &value) {
+  auto index = this->index_of(value);
+  if (!index.has_value()) return;
+
+  // mixer mode is rejected if not valid for dac mode, so republish current mixer mode
+  uint8_t mode = index.value();
+  if (!this->parent_->set_mixer_mode(static_cast<MixerMode>(mode))) {
+    mode = this->parent_->mixer_mode();
+  }
+  auto option = this->at(mode);
+  if (option.has_value()) this->publish_state(option.value());
+  this->pref_.save(&mode);
+}
+
+}  // namespace esphome::tas5805m
@@ -3,15 +3,64 @@ from esphome.components import sensor
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_ID,
+    DEVICE_CLASS_DURATION,
+    DEVICE_CLASS_FREQUENCY,
+    DEVICE_CLASS_SOUND_PRESSURE,
+    ENTITY_CATEGORY_DIAGNOSTIC,
     STATE_CLASS_MEASUREMENT,
+    STATE_CLASS_TOTAL_INCREASING,
+    UNIT_DECIBEL,
+    UNIT_HERTZ,
+    UNIT_MILLISECOND,
+    UNIT_SECOND,
 )
 
 CONF_FAULTS_CLEARED = "faults_cleared"
+CONF_BCK_RATIO = "bck_ratio"
+CONF_CLOCK_FAULTS_PER_MINUTE = "clock_faults_per_minute"
+CONF_CLOCK_MTBG = "clock_mtbg"
+CONF_SAMPLE_RATE = "sample_rate"
+CONF_FAULT_RECOVERY_LOCKOUTS = "fault_recovery_lockouts"
+CONF_FAULT_RECOVERY_RETRIES = "fault_recovery_retries"
+CONF_DEEP_SLEEP_WAKE_LATENCY = "deep_sleep_wake_latency"
+CONF_HI_Z_WAKE_LATENCY = "hi_z_wake_latency"
+CONF_HYSTERESIS = "hysteresis"
+CONF_LEFT_CHANNEL_LEVEL = "left_channel_level"
+CONF_LEVEL_PUBLISH_INTERVAL = "level_publish_interval"
+CONF_RIGHT_CHANNEL_LEVEL = "right_channel_level"
+CONF_THERMAL_FOLDBACK = "thermal_foldback"
+CONF_OUTPUT_LATENCY = "output_latency"
+
+ICON_THERMOMETER_ALERT = "mdi:thermometer-alert"
+ICON_VOLUME_HIGH = "mdi:volume-high"
 
 from ..audio_dac import CONF_TAS5805M_ID, Tas5805mComponent, tas5805m_ns
 
 FaultSensor = tas5805m_ns.class_("FaultSensor", cg.PollingComponent)
 
+LEVEL_SENSOR_SCHEMA = sensor.sensor_schema(
+    unit_of_measurement=UNIT_DECIBEL,
+    icon=ICON_VOLUME_HIGH,
+    accuracy_decimals=1,
+    device_class=DEVICE_CLASS_SOUND_PRESSURE,
+    state_class=STATE_CLASS_MEASUREMENT,
+    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+).extend(
+    {
+        cv.Optional(CONF_HYSTERESIS, default="1dB"): cv.All(
+                    cv.decibel, cv.float_range(min=0, max=20)
+        ),
+    }
+)
+
+WAKE_LATENCY_SCHEMA = sensor.sensor_schema(
+    unit_of_measurement=UNIT_MILLISECOND,
+    accuracy_decimals=1,
+    device_class=DEVICE_CLASS_DURATION,
+    state_class=STATE_CLASS_MEASUREMENT,
+    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+)
+
 CONFIG_SCHEMA = (
     cv.Schema(
         {
@@ -22,11 +71,72 @@ CONFIG_SCHEMA = (
                     accuracy_decimals=0,
                     state_class=STATE_CLASS_MEASUREMENT,
             ),
+
+            cv.Optional(CONF_FAULT_RECOVERY_RETRIES): sensor.sensor_schema(
+                    accuracy_decimals=0,
+                    state_class=STATE_CLASS_MEASUREMENT,
+                    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            ),
+            cv.Optional(CONF_FAULT_RECOVERY_LOCKOUTS): sensor.sensor_schema(
+                    accuracy_decimals=0,
+                    state_class=STATE_CLASS_TOTAL_INCREASING,
+                    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            ),
+
+            cv.Optional(CONF_OUTPUT_LATENCY): sensor.sensor_schema(
+                    unit_of_measurement=UNIT_MILLISECOND,
+                    accuracy_decimals=3,
+                    state_class=STATE_CLASS_MEASUREMENT,
+                    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            ),
+
+            cv.Optional(CONF_THERMAL_FOLDBACK): sensor.sensor_schema(
+                    unit_of_measurement=UNIT_DECIBEL,
+                    icon=ICON_THERMOMETER_ALERT,
+                    accuracy_decimals=1,
+                    state_class=STATE_CLASS_MEASUREMENT,
+                    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            ),
+
+            cv.Optional(CONF_SAMPLE_RATE): sensor.sensor_schema(
+                    unit_of_measurement=UNIT_HERTZ,
+                    accuracy_decimals=0,
+                    device_class=DEVICE_CLASS_FREQUENCY,
+                    state_class=STATE_CLASS_MEASUREMENT,
+                    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            ),
+            cv.Optional(CONF_BCK_RATIO): sensor.sensor_schema(
+                    accuracy_decimals=0,
+                    state_class=STATE_CLASS_MEASUREMENT,
+                    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            ),
+            cv.Optional(CONF_CLOCK_FAULTS_PER_MINUTE): sensor.sensor_schema(
+                    accuracy_decimals=0,
+                    state_class=STATE_CLASS_MEASUREMENT,
+                    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            ),
+            cv.Optional(CONF_CLOCK_MTBG): sensor.sensor_schema(
+                    unit_of_measurement=UNIT_SECOND,
+                    accuracy_decimals=1,
+                    device_class=DEVICE_CLASS_DURATION,
+                    state_class=STATE_CLASS_MEASUREMENT,
+                    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            ),
+
+            cv.Optional(CONF_LEFT_CHANNEL_LEVEL): LEVEL_SENSOR_SCHEMA,
+            cv.Optional(CONF_RIGHT_CHANNEL_LEVEL): LEVEL_SENSOR_SCHEMA,
+            cv.Optional(CONF_HI_Z_WAKE_LATENCY): WAKE_LATENCY_SCHEMA,
+            cv.Optional(CONF_DEEP_SLEEP_WAKE_LATENCY): WAKE_LATENCY_SCHEMA,
+            cv.Optional(CONF_LEVEL_PUBLISH_INTERVAL, default="5s"): cv.All(
+                    cv.positive_time_period_milliseconds,
+                    cv.Range(min=cv.TimePeriod(milliseconds=100)),
+            ),
         }
     ).extend(cv.polling_component_schema("60s"))
 )
 
 async def to_code(config):
+    cg.add_define("USE_TAS5805M_SENSOR")
     tas5805m_component = await cg.get_variable(config[CONF_TAS5805M_ID])
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
@@ -35,3 +145,55 @@ async def to_code(config):
     if clear_faults_config := config.get(CONF_FAULTS_CLEARED):
       sens = await sensor.new_sensor(clear_faults_config)
       cg.add(var.set_times_faults_cleared_sensor(sens))
+
+    if recovery_config := config.get(CONF_FAULT_RECOVERY_RETRIES):
+      sens = await sensor.new_sensor(recovery_config)
+      cg.add(tas5805m_component.set_fault_recovery_retries_sensor(sens))
+
+    if recovery_config := config.get(CONF_FAULT_RECOVERY_LOCKOUTS):
+      sens = await sensor.new_sensor(recovery_config)
+      cg.add(tas5805m_component.set_fault_recovery_lockouts_sensor(sens))
+
+    if latency_config := config.get(CONF_OUTPUT_LATENCY):
+      sens = await sensor.new_sensor(latency_config)
+      cg.add(tas5805m_component.set_output_latency_sensor(sens))
+
+    if foldback_config := config.get(CONF_THERMAL_FOLDBACK):
+      sens = await sensor.new_sensor(foldback_config)
+      cg.add(tas5805m_component.set_thermal_foldback_sensor(sens))
+
+    if clock_config := config.get(CONF_SAMPLE_RATE):
+      sens = await sensor.new_sensor(clock_config)
+      cg.add(tas5805m_component.set_sample_rate_sensor(sens))
+
+    if clock_config := config.get(CONF_BCK_RATIO):
+      sens = await sensor.new_sensor(clock_config)
+      cg.add(tas5805m_component.set_bck_ratio_sensor(sens))
+
+    if clock_config := config.get(CONF_CLOCK_FAULTS_PER_MINUTE):
+      sens = await sensor.new_sensor(clock_config)
+      cg.add(tas5805m_component.set_clock_faults_per_minute_sensor(sens))
+
+    if clock_config := config.get(CONF_CLOCK_MTBG):
+      sens = await sensor.new_sensor(clock_config)
+      cg.add(tas5805m_component.set_clock_mtbg_sensor(sens))
+
+    if level_config := config.get(CONF_LEFT_CHANNEL_LEVEL):
+      sens = await sensor.new_sensor(level_config)
+      cg.add(tas5805m_component.set_left_channel_level_sensor(sens))
+      cg.add(tas5805m_component.config_left_channel_level_hysteresis(level_config[CONF_HYSTERESIS]))
+
+    if level_config := config.get(CONF_RIGHT_CHANNEL_LEVEL):
+      sens = await sensor.new_sensor(level_config)
+      cg.add(tas5805m_component.set_right_channel_level_sensor(sens))
+      cg.add(tas5805m_component.config_right_channel_level_hysteresis(level_config[CONF_HYSTERESIS]))
+
+    if latency_config := config.get(CONF_HI_Z_WAKE_LATENCY):
+      sens = await sensor.new_sensor(latency_config)
+      cg.add(tas5805m_component.set_hi_z_wake_latency_sensor(sens))
+
+    if latency_config := config.get(CONF_DEEP_SLEEP_WAKE_LATENCY):
+      sens = await sensor.new_sensor(latency_config)
+      cg.add(tas5805m_component.set_deep_sleep_wake_latency_sensor(sens))
+
+    cg.add(tas5805m_component.config_level_publish_interval(config[CONF_LEVEL_PUBLISH_INTERVAL]))
@@ -3,6 +3,9 @@
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/hal.h"
+#include <cmath>
+#include <cstring>
+#include <sys/time.h>
 
 namespace esphome::tas5805m {
 
@@ -10,10 +13,14 @@ static const char *const TAG               = "tas5805m";
 static const char *const ERROR             = "Error ";
 static const char *const MIXER_MODE        = "Mixer Mode";
 static const char *const EQ_BAND           = "EQ Band ";
+static const char *const CHANNEL_VOLUME    = "Channel Volume";
 
 static const uint8_t TAS5805M_MUTE_CONTROL = 0x08;  // LR Channel Mute
 static const uint8_t REMOVE_CLOCK_FAULT    = 0xFB;  // used to zero clock fault bit of global_fault1 register
 
+// ms to wait in Hi-Z when leaving sleep or deep sleep before entering play
+static const uint8_t STATE_SETTLE_TIME     = 5;
+
 // maximum delay allowed in "tas5805m_minimal.h" used in configure_registers()
 static const uint8_t ESPHOME_MAXIMUM_DELAY = 5;     // milliseconds
 
@@ -21,9 +28,68 @@ static const uint8_t ESPHOME_MAXIMUM_DELAY = 5;     // milliseconds
 // played and tas5805m has detected i2s clock
 static const uint8_t DELAY_LOOPS           = 20;    // 20 loop iterations ~ 320ms
 
+// most fault binary sensors published in one loop iteration
+static const uint8_t FAULT_SENSORS_PER_PUBLISH = 4;
+
 // initial ms delay before starting fault updates
 static const uint16_t INITIAL_UPDATE_DELAY = 4000;
 
+// longest ms an amplifier group member waits for the previous member to refresh settings
+static const uint32_t REFRESH_AFTER_TIMEOUT = 5000;
+
+// staged changes are only committed this far ahead, a later commit time is taken
+// as an unsynchronised clock
+static const uint32_t MAX_COMMIT_LEAD_TIME    = 60000;  // milliseconds
+// commits later than this are logged as a warning
+static const uint32_t COMMIT_LATE_WARNING     = 20;     // milliseconds
+
+// sample rate assumed when timing hardware volume ramps
+static const uint32_t VOLUME_RAMP_SAMPLE_RATE = 48000;
+// shortest interval between volume writes of a fade longer than the hardware ramp
+static const uint32_t FADE_MIN_STEP_INTERVAL  = 50;     // milliseconds
+
+// runtime mixer changes are ramped over MIXER_RAMP_STEPS writes
+static const uint32_t MIXER_STEP_INTERVAL  = 20;     // milliseconds
+static const uint8_t  MIXER_RAMP_STEPS     = 8;
+
+// interval between dsp volume writes when ducking ramps
+static const uint32_t DUCK_STEP_INTERVAL   = 25;     // milliseconds
+
+// thermal foldback changes are ramped in THERMAL_RAMP_STEP_DB steps every DUCK_STEP_INTERVAL
+static const float THERMAL_RAMP_STEP_DB    = 0.5;
+
+// level meter words are 1.31 format
+static const float LEVEL_METER_FULL_SCALE  = 2147483648.0;  // 2^31
+
+static uint16_t switching_frequency_khz(SwitchingFrequency fsw) {
+  switch (fsw) {
+    case FSW_384KHZ: return 384;
+    case FSW_480KHZ: return 480;
+    case FSW_576KHZ: return 576;
+    default:         return 768;
+  }
+}
+
+// system clock in ms since the epoch
+static int64_t epoch_ms() {
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  return ((int64_t) tv.tv_sec * 1000) + (tv.tv_usec / 1000);
+}
+
+// FS_MON detected sample rate, zero for FS error or reserved values
+// 44.1kHz and 88.2kHz are detected as 48kHz and 96kHz
+static uint32_t fs_mon_sample_rate(uint8_t fs_mon) {
+  switch (fs_mon & TAS5805M_FS_MON_FS_MASK) {
+    case 0x02: return 8000;
+    case 0x04: return 16000;
+    case 0x06: return 32000;
+    case 0x09: return 48000;
+    case 0x0B: return 96000;
+    default:   return 0;
+  }
+}
+
 void Tas5805mComponent::setup() {
   ESP_LOGCONFIG(TAG, "Running setup");
   if (this->enable_pin_ != nullptr) {
@@ -38,9 +104,20 @@ void Tas5805mComponent::setup() {
     this->mark_failed();
   }
 
+  if (this->fault_pin_ != nullptr) {
+    this->fault_pin_->setup();
+    this->fault_pin_->attach_interrupt(&Tas5805mComponent::fault_isr_, this, gpio::INTERRUPT_FALLING_EDGE);
+  }
+
   // rescale -103db to 24db digital volume range to register digital volume range 254 to 0
   this->tas5805m_raw_volume_max_ = (uint8_t)((this->tas5805m_volume_max_ - 24) * -2);
   this->tas5805m_raw_volume_min_ = (uint8_t)((this->tas5805m_volume_min_ - 24) * -2);
+
+  this->update_output_latency_();
+
+  // level meter only polls if level sensors are configured
+  // level meter callbacks added later restart it at 'level_meter_interval'
+  this->start_level_meter_();
 }
 
 bool Tas5805mComponent::configure_registers_() {
@@ -63,16 +140,20 @@ bool Tas5805mComponent::configure_registers_() {
   }
   this->number_registers_configured_ = counter;
 
-  // enable Tas5805m
-  if(!this->set_deep_sleep_off_()) return false;
+  // configure in Hi-Z, enter play once configured
+  if(!this->set_state_(CTRL_HI_Z)) return false;
+
+  if (!this->write_serial_audio_port_()) return false;
 
-  // only setup once here
-  if (!this->set_dac_mode_(this->tas5805m_dac_mode_)) return false;
+  if (!this->write_device_ctrl_1_(this->tas5805m_switching_frequency_, this->tas5805m_dac_mode_,
+                                   this->tas5805m_modulation_mode_)) return false;
 
   // note: setup of mixer mode deferred to 'loop' once 'refresh_settings' runs
 
   if (!this->set_analog_gain_(this->tas5805m_analog_gain_)) return false;
 
+  if (!this->set_volume_ramp_(this->tas5805m_volume_ramp_)) return false;
+
   if (!this->set_state_(CTRL_PLAY)) return false;
 
   #ifdef USE_TAS5805M_EQ
@@ -85,10 +166,23 @@ bool Tas5805mComponent::configure_registers_() {
 
   // initialise to now
   this->start_time_ = millis();
+  this->last_activity_ = this->start_time_;
   return true;
 }
 
+void IRAM_ATTR Tas5805mComponent::fault_isr_(Tas5805mComponent* component) {
+  component->fault_interrupt_ = true;
+  component->enable_loop_soon_any_context();
+}
+
 void Tas5805mComponent::loop() {
+  // FAULTZ interrupt, faults are read here since i2c cannot be used in the isr
+  // before the initial update delay has finished faults are cleared by 'update'
+  if (this->fault_interrupt_) {
+    this->fault_interrupt_ = false;
+    this->request_fault_check();
+  }
+
   // 'play_file' is initiated by YAML on_boot with priority 220.0f
   // 'refresh_settings' is set by 'eq_gainband16000hz' or 'enable_eq_switch' (defined by YAML)
   // both have setup priority AFTER_CONNECTION = 100.0f
@@ -105,6 +199,14 @@ void Tas5805mComponent::loop() {
   // refresh of settings has not been triggered yet
   if (!this->refresh_settings_triggered_) return;
 
+  // in an amplifier group only one member refreshes settings at a time
+  // unless the previous member has not refreshed settings in time
+  if ((this->refresh_after_ != nullptr) && !this->refresh_after_->is_refresh_complete()) {
+    if ((millis() - this->refresh_triggered_time_) < REFRESH_AFTER_TIMEOUT) return;
+    ESP_LOGW(TAG, "Previous amp has not refreshed settings, refreshing now");
+    this->refresh_after_ = nullptr;
+  }
+
   // once refresh settings is triggered then wait 'DELAY_LOOPS' before proceeding
   // to ensure on boot sound has played and tas5805m has detected i2s clock
   if (this->loop_counter_ < DELAY_LOOPS) {
@@ -113,11 +215,18 @@ void Tas5805mComponent::loop() {
   }
 
   if (!this->mixer_mode_configured_) {
-    if (!this->set_mixer_mode_(this->tas5805m_mixer_mode_)) {
+    float gains[4];
+    for (uint8_t path = 0; path < 4; path++) gains[path] = this->mixer_target_gain_(path);
+    if (!this->write_mixer_gains_(gains)) {
       // show warning but continue as if mixer mode was set ok
       ESP_LOGW(TAG, "%ssetting mixer mode: %s", ERROR, MIXER_MODE);
     }
 
+    // dsp volume words are written with mixer since both need the i2s clock
+    if (!this->write_channel_volume_()) {
+      ESP_LOGW(TAG, "%ssetting %s", ERROR, CHANNEL_VOLUME);
+    }
+
     this->mixer_mode_configured_ = true;
 
     // if eq gains have not been configured in YAML
@@ -172,11 +281,62 @@ void Tas5805mComponent::update() {
     this->publish_faults_();
     #endif
 
-    // read and process faults from next update
+    // faults are polled from now on by their own adaptive schedule
+    this->request_fault_check();
+    return;
+  }
+
+  // in an amplifier group the FS_MON reads of members are staggered like their fault polls
+  // kept within the update interval so a pending read is never replaced by the next update
+  uint32_t offset = this->fault_poll_offset_ % this->get_update_interval();
+  if (offset == 0) {
+    this->update_power_management_();
     return;
   }
+  this->set_timeout("power_management", offset, [this]() { this->update_power_management_(); });
+}
+
+// an immediate check is followed by fast polls which back off again while the device is clean
+void Tas5805mComponent::request_fault_check() {
+  if (!this->update_delay_finished_) return;
+  this->fault_poll_interval_ = this->fault_poll_min_interval_;
+  this->set_timeout("fault_poll", 0, [this]() { this->fault_poll_(); });
+}
+
+// polls at 'fault_poll_min_interval_' while faults, clock faults or fault changes are seen,
+// otherwise doubles the interval each poll up to 'fault_poll_max_interval_'
+// ignored clock faults do not speed up polling, they are cleared as they are seen so each new glitch is counted
+void Tas5805mComponent::fault_poll_() {
+  bool read_ok = this->process_faults_();
+
+  bool clock_fault = this->tas5805m_faults_.clock_fault && !this->ignore_clock_faults_when_clearing_faults_;
+  bool unstable = !read_ok || this->is_fault_to_clear_ || clock_fault ||
+                  this->tas5805m_faults_.is_fault_except_clock_fault || this->is_fault_pin_asserted_() ||
+                  this->is_new_common_fault_ || this->is_new_over_temperature_issue_ ||
+                  this->is_new_channel_fault_ || this->is_new_global_fault_;
+
+  // a locked out fault is not expected to change so is polled slowly
+  if (this->recovery_state_ == RECOVERY_LOCKOUT) {
+    this->fault_poll_interval_ = this->fault_poll_max_interval_;
+  } else if (unstable) {
+    this->fault_poll_interval_ = this->fault_poll_min_interval_;
+  } else {
+    this->fault_poll_interval_ = std::min(this->fault_poll_interval_ * 2, this->fault_poll_max_interval_);
+  }
+  this->set_timeout("fault_poll", this->fault_poll_delay_(this->fault_poll_interval_), [this]() { this->fault_poll_(); });
+}
+
+// in an amplifier group the regular polls of each member fall only in its own slots, 'fault_poll_offset_' plus a multiple
+// of 'fault_poll_min_interval_', so members stay staggered however their poll intervals adapt
+uint32_t Tas5805mComponent::fault_poll_delay_(uint32_t interval) {
+  if (!this->fault_poll_staggered_) return interval;
+  uint32_t past_slot = (millis() + interval - this->fault_poll_offset_) % this->fault_poll_min_interval_;
+  if (past_slot == 0) return interval;
+  return interval + this->fault_poll_min_interval_ - past_slot;
+}
 
-  // if there was a fault last update then clear any faults
+bool Tas5805mComponent::process_faults_() {
+  // if there was a fault last read then clear any faults
   if (this->is_fault_to_clear_) {
     if (!this->clear_fault_registers_()) {
       ESP_LOGW(TAG, "%sclearing faults", ERROR);
@@ -185,93 +345,107 @@ void Tas5805mComponent::update() {
 
   if (!this->read_fault_registers_()) {
     ESP_LOGW(TAG, "%sreading faults", ERROR);
-    return;
+    return false;
+  }
+
+  this->update_clock_health_();
+
+  // over temperature warning starts thermal foldback
+  if (this->tas5805m_faults_.temperature_warning) {
+    this->last_thermal_warning_ = millis();
+    if (!this->thermal_foldback_running_ && (this->thermal_foldback_step_db_ > 0.0f)) {
+      this->thermal_foldback_running_ = true;
+      this->thermal_foldback_step_();
+      this->set_interval("thermal_foldback", this->thermal_foldback_interval_, [this]() { this->thermal_foldback_step_(); });
+    }
+  }
+
+  // over current and dc faults are cleared by fault recovery
+  if ((this->tas5805m_faults_.channel_fault != 0) && (this->recovery_state_ == RECOVERY_IDLE)) {
+    this->start_fault_recovery_();
   }
 
   // is there a fault that should be cleared next update
+  bool is_other_fault = ( this->tas5805m_faults_.global_fault || this->tas5805m_faults_.temperature_fault ||
+                          this->tas5805m_faults_.temperature_warning );
   this->is_fault_to_clear_ =
-     ( this->tas5805m_faults_.is_fault_except_clock_fault || (this->tas5805m_faults_.clock_fault && (!this->ignore_clock_faults_when_clearing_faults_)) );
+     ( is_other_fault || (this->tas5805m_faults_.clock_fault && (!this->ignore_clock_faults_when_clearing_faults_)) );
 
 
   // if no change in faults bypass publishing
-  if ( !(this->is_new_common_fault_ || this->is_new_over_temperature_issue_ || this->is_new_channel_fault_ || this->is_new_global_fault_) ) return;
+  if ( !(this->is_new_common_fault_ || this->is_new_over_temperature_issue_ || this->is_new_channel_fault_ || this->is_new_global_fault_) ) return true;
 
   #ifdef USE_TAS5805M_BINARY_SENSOR
   this->publish_faults_();
   #endif
+  return true;
 }
 
 #ifdef USE_TAS5805M_BINARY_SENSOR
+// only binary sensors whose fault bit has flipped since last published are published
+// publishing is spread over loop iterations from a single named timeout, which always
+// compares against the latest fault state so a later request replacing it loses nothing
 void Tas5805mComponent::publish_faults_() {
-  if (this->is_new_common_fault_) {
-    if (this->have_fault_binary_sensor_ != nullptr) {
-      this->have_fault_binary_sensor_->publish_state(this->tas5805m_faults_.have_fault);
-    }
-
-    if (this->clock_fault_binary_sensor_ != nullptr) {
-      this->clock_fault_binary_sensor_->publish_state(this->tas5805m_faults_.clock_fault);
-    }
-  }
-
-  if (this->is_new_over_temperature_issue_) {
-    if (this->over_temperature_shutdown_fault_binary_sensor_ != nullptr) {
-      this->over_temperature_shutdown_fault_binary_sensor_->publish_state(this->tas5805m_faults_.temperature_fault);
-    }
-
-    if (this->over_temperature_warning_binary_sensor_ != nullptr) {
-      this->over_temperature_warning_binary_sensor_->publish_state(this->tas5805m_faults_.temperature_warning);
-    }
-  }
+  uint16_t changed = (this->fault_sensor_bits_() ^ this->published_fault_bits_) | this->unpublished_fault_bits_;
+  if (changed == 0) return;
+  this->set_timeout("publish_faults", 0, [this]() { this->publish_fault_sensors_(); });
+}
 
-  // publish channel and global faults in separate loop iterations to spread component time when publishing binary sensors
-  if (this->is_new_channel_fault_) {
-    this->set_timeout("", 15, [this]() { this->publish_channel_faults_(); });
-  }
-  else {
-    if (this->is_new_global_fault_) {
-      this->set_timeout("", 15, [this]() { this->publish_global_faults_(); });
+void Tas5805mComponent::publish_fault_sensors_() {
+  uint16_t current = this->fault_sensor_bits_();
+  uint16_t changed = (current ^ this->published_fault_bits_) | this->unpublished_fault_bits_;
+  uint8_t published = 0;
+
+  for (uint8_t bit = 0; (bit < FAULT_SENSOR_COUNT) && (changed != 0); bit++) {
+    uint16_t mask = 1 << bit;
+    if (!(changed & mask)) continue;
+
+    binary_sensor::BinarySensor* sensor = this->fault_binary_sensor_(bit);
+    if (sensor != nullptr) {
+      // publish remaining binary sensors in a later loop iteration
+      if (published == FAULT_SENSORS_PER_PUBLISH) {
+        this->set_timeout("publish_faults", 15, [this]() { this->publish_fault_sensors_(); });
+        return;
+      }
+      sensor->publish_state(current & mask);
+      published++;
     }
+    this->published_fault_bits_ = (this->published_fault_bits_ & ~mask) | (current & mask);
+    this->unpublished_fault_bits_ &= ~mask;
+    changed &= ~mask;
   }
 }
 
-void Tas5805mComponent::publish_channel_faults_() {
-  if (this->right_channel_over_current_fault_binary_sensor_ != nullptr) {
-    this->right_channel_over_current_fault_binary_sensor_->publish_state(this->tas5805m_faults_.channel_fault & (1 << 0));
-  }
-
-  if (this->left_channel_over_current_fault_binary_sensor_ != nullptr) {
-    this->left_channel_over_current_fault_binary_sensor_->publish_state(this->tas5805m_faults_.channel_fault & (1 << 1));
-  }
-
-  if (this->right_channel_dc_fault_binary_sensor_ != nullptr) {
-    this->right_channel_dc_fault_binary_sensor_->publish_state(this->tas5805m_faults_.channel_fault & (1 << 2));
-  }
-
-  if (this->left_channel_dc_fault_binary_sensor_ != nullptr) {
-    this->left_channel_dc_fault_binary_sensor_->publish_state(this->tas5805m_faults_.channel_fault & (1 << 3));
-  }
-
-  if (this->is_new_global_fault_) {
-      this->set_timeout("", 15, [this]() { this->publish_global_faults_(); });
-  }
+// one bit per fault binary sensor, channel faults keep their CHAN_FAULT register positions
+uint16_t Tas5805mComponent::fault_sensor_bits_() {
+  const Tas5805mFault* faults = &this->tas5805m_faults_;
+  uint16_t bits = faults->channel_fault & 0x0F;
+  if (faults->global_fault & (1 << 0)) bits |= (1 << FAULT_SENSOR_PVDD_UNDER_VOLTAGE);
+  if (faults->global_fault & (1 << 1)) bits |= (1 << FAULT_SENSOR_PVDD_OVER_VOLTAGE);
+  if (faults->global_fault & (1 << 6)) bits |= (1 << FAULT_SENSOR_BQ_WRITE_FAILED);
+  if (faults->global_fault & (1 << 7)) bits |= (1 << FAULT_SENSOR_OTP_CRC_CHECK);
+  if (faults->clock_fault) bits |= (1 << FAULT_SENSOR_CLOCK);
+  if (faults->temperature_fault) bits |= (1 << FAULT_SENSOR_OVER_TEMPERATURE_SHUTDOWN);
+  if (faults->temperature_warning) bits |= (1 << FAULT_SENSOR_OVER_TEMPERATURE_WARNING);
+  if (faults->have_fault) bits |= (1 << FAULT_SENSOR_HAVE_FAULT);
+  return bits;
 }
 
-
-void Tas5805mComponent::publish_global_faults_() {
-  if (this->pvdd_under_voltage_fault_binary_sensor_ != nullptr) {
-    this->pvdd_under_voltage_fault_binary_sensor_->publish_state(this->tas5805m_faults_.global_fault & (1 << 0));
-  }
-
-  if (this->pvdd_over_voltage_fault_binary_sensor_ != nullptr) {
-    this->pvdd_over_voltage_fault_binary_sensor_->publish_state(this->tas5805m_faults_.global_fault & (1 << 1));
-  }
-
-  if (this->bq_write_failed_fault_binary_sensor_ != nullptr) {
-    this->bq_write_failed_fault_binary_sensor_->publish_state(this->tas5805m_faults_.global_fault & (1 << 6));
-  }
-
-  if (this->otp_crc_check_error_binary_sensor_ != nullptr) {
-    this->otp_crc_check_error_binary_sensor_->publish_state(this->tas5805m_faults_.global_fault & (1 << 7));
+binary_sensor::BinarySensor* Tas5805mComponent::fault_binary_sensor_(uint8_t bit) {
+  switch (bit) {
+    case FAULT_SENSOR_RIGHT_OVER_CURRENT:         return this->right_channel_over_current_fault_binary_sensor_;
+    case FAULT_SENSOR_LEFT_OVER_CURRENT:          return this->left_channel_over_current_fault_binary_sensor_;
+    case FAULT_SENSOR_RIGHT_DC:                   return this->right_channel_dc_fault_binary_sensor_;
+    case FAULT_SENSOR_LEFT_DC:                    return this->left_channel_dc_fault_binary_sensor_;
+    case FAULT_SENSOR_PVDD_UNDER_VOLTAGE:         return this->pvdd_under_voltage_fault_binary_sensor_;
+    case FAULT_SENSOR_PVDD_OVER_VOLTAGE:          return this->pvdd_over_voltage_fault_binary_sensor_;
+    case FAULT_SENSOR_BQ_WRITE_FAILED:            return this->bq_write_failed_fault_binary_sensor_;
+    case FAULT_SENSOR_OTP_CRC_CHECK:              return this->otp_crc_check_error_binary_sensor_;
+    case FAULT_SENSOR_CLOCK:                      return this->clock_fault_binary_sensor_;
+    case FAULT_SENSOR_OVER_TEMPERATURE_SHUTDOWN:  return this->over_temperature_shutdown_fault_binary_sensor_;
+    case FAULT_SENSOR_OVER_TEMPERATURE_WARNING:   return this->over_temperature_warning_binary_sensor_;
+    case FAULT_SENSOR_HAVE_FAULT:                 return this->have_fault_binary_sensor_;
+    default:                                      return nullptr;
   }
 }
 #endif
@@ -285,6 +459,7 @@ void Tas5805mComponent::dump_config() {
       break;
     case NONE:
       LOG_PIN("  Enable Pin: ", this->enable_pin_);
+      LOG_PIN("  Fault Pin: ", this->fault_pin_);
       LOG_I2C_DEVICE(this);
       ESP_LOGCONFIG(TAG,
               "  Registers Configured: %i\n"
@@ -302,6 +477,47 @@ void Tas5805mComponent::dump_config() {
               this->ignore_clock_faults_when_clearing_faults_ ? "CLOCK FAULTS" : "NONE",
               this->auto_refresh_ ? "BY SWITCH" : "BY GAIN"
               );
+      ESP_LOGCONFIG(TAG,
+              "  I2S Format: %s\n"
+              "  Word Length: %ubit",
+              SERIAL_FORMAT_TEXT[this->serial_format_], WORD_LENGTH_BITS[this->word_length_]);
+      if (this->serial_format_ == FORMAT_TDM) {
+        ESP_LOGCONFIG(TAG, "  TDM Slot: %u", this->tdm_slot_);
+      }
+      ESP_LOGCONFIG(TAG,
+              "  Switching Frequency: %ukHz\n"
+              "  Modulation Mode: %s\n"
+              "  Pipeline Latency: %u samples",
+              switching_frequency_khz(this->tas5805m_switching_frequency_),
+              MODULATION_MODE_TEXT[this->tas5805m_modulation_mode_], this->pipeline_latency_samples_);
+      if ((this->idle_hi_z_timeout_ != 0) || (this->idle_deep_sleep_timeout_ != 0)) {
+        ESP_LOGCONFIG(TAG,
+              "  Idle Hi-Z Timeout: %us\n"
+              "  Idle Deep Sleep Timeout: %us\n"
+              "  Idle Level Threshold: %3.1fdB",
+              this->idle_hi_z_timeout_ / 1000, this->idle_deep_sleep_timeout_ / 1000, this->idle_level_threshold_db_);
+      }
+      ESP_LOGCONFIG(TAG,
+              "  Mixer Gains: L-L %3.1fdB R-L %3.1fdB L-R %3.1fdB R-R %3.1fdB",
+              this->mixer_gain_db_[MIXER_LEFT_TO_LEFT], this->mixer_gain_db_[MIXER_RIGHT_TO_LEFT],
+              this->mixer_gain_db_[MIXER_LEFT_TO_RIGHT], this->mixer_gain_db_[MIXER_RIGHT_TO_RIGHT]);
+      ESP_LOGCONFIG(TAG,
+              "  Balance: %3.2f\n"
+              "  Channel Volume: L %3.1fdB R %3.1fdB",
+              this->tas5805m_balance_,
+              this->tas5805m_channel_volume_db_[0], this->tas5805m_channel_volume_db_[1]);
+      ESP_LOGCONFIG(TAG,
+              "  Volume Ramp: 0x%02X\n"
+              "  Level Meter Interval: %ums",
+              this->tas5805m_volume_ramp_, this->level_meter_interval_);
+      ESP_LOGCONFIG(TAG,
+              "  Fault Poll Interval: %ums to %ums\n"
+              "  Fault Recovery: backoff %ums, %d retries in %us\n"
+              "  Thermal Foldback: %3.1fdB steps to %3.1fdB every %us, hold %us",
+              this->fault_poll_min_interval_, this->fault_poll_max_interval_,
+              this->fault_recovery_backoff_, this->fault_recovery_max_retries_, this->fault_recovery_window_ / 1000,
+              this->thermal_foldback_step_db_, this->thermal_foldback_max_db_,
+              this->thermal_foldback_interval_ / 1000, this->thermal_foldback_hold_ / 1000);
       LOG_UPDATE_INTERVAL(this);
       break;
   }
@@ -323,16 +539,272 @@ void Tas5805mComponent::dump_config() {
   LOG_BINARY_SENSOR("  ", "Over Temperature Shutdown", this->over_temperature_shutdown_fault_binary_sensor_);
   LOG_BINARY_SENSOR("  ", "Over Temperature Warning", this->over_temperature_warning_binary_sensor_);
   #endif
+
+  #ifdef USE_TAS5805M_SENSOR
+  ESP_LOGCONFIG(TAG, "Tas5805m Level Sensors:");
+  LOG_SENSOR("  ", "Left Channel Level", this->left_channel_level_sensor_);
+  LOG_SENSOR("  ", "Right Channel Level", this->right_channel_level_sensor_);
+  ESP_LOGCONFIG(TAG,
+                "    Hysteresis: %3.1fdB / %3.1fdB\n"
+                "    Publish Interval: %ums",
+                this->level_hysteresis_[0], this->level_hysteresis_[1], this->level_publish_interval_);
+  LOG_SENSOR("", "Hi-Z Wake Latency", this->hi_z_wake_latency_sensor_);
+  LOG_SENSOR("", "Deep Sleep Wake Latency", this->deep_sleep_wake_latency_sensor_);
+  LOG_SENSOR("", "Fault Recovery Retries", this->fault_recovery_retries_sensor_);
+  LOG_SENSOR("", "Fault Recovery Lockouts", this->fault_recovery_lockouts_sensor_);
+  LOG_SENSOR("", "Thermal Foldback", this->thermal_foldback_sensor_);
+  LOG_SENSOR("", "Sample Rate", this->sample_rate_sensor_);
+  LOG_SENSOR("", "BCK Ratio", this->bck_ratio_sensor_);
+  LOG_SENSOR("", "Clock Faults Per Minute", this->clock_faults_per_minute_sensor_);
+  LOG_SENSOR("", "Clock MTBG", this->clock_mtbg_sensor_);
+  LOG_SENSOR("", "Output Latency", this->output_latency_sensor_);
+  #endif
+
+  #ifdef USE_TAS5805M_TEXT_SENSOR
+  LOG_TEXT_SENSOR("", "Last Fault Event", this->last_fault_event_text_sensor_);
+  LOG_TEXT_SENSOR("", "Power State", this->power_state_text_sensor_);
+  #endif
 }
 
 
 // public
 
+// used by other components wanting level meter readings eg led vu meter
+// all consumers share the one level meter read per interval
+void Tas5805mComponent::add_on_level_meter_callback(std::function<void(float, float)> &&callback) {
+  this->level_meter_callback_.add(std::move(callback));
+  this->start_level_meter_();
+}
+
+void Tas5805mComponent::add_on_output_latency_callback(std::function<void(float)> &&callback) {
+  this->output_latency_callback_.add(std::move(callback));
+  this->output_latency_tracked_ = true;
+}
+
+void Tas5805mComponent::add_on_mixer_callback(std::function<void()> &&callback) {
+  this->mixer_callback_.add(std::move(callback));
+}
+
+uint8_t Tas5805mComponent::get_level_history(Tas5805mLevel* levels, uint8_t max_levels) {
+  uint8_t number_levels = std::min(max_levels, this->level_history_count_);
+  for (uint8_t i = 0; i < number_levels; i++) {
+    uint8_t index = (this->level_history_head_ + LEVEL_METER_HISTORY_SIZE - 1 - i) % LEVEL_METER_HISTORY_SIZE;
+    levels[i] = this->level_history_[index];
+  }
+  return number_levels;
+}
+
+bool Tas5805mComponent::get_latest_level(Tas5805mLevel* level) {
+  return (this->get_level_history(level, 1) == 1);
+}
+
+// used by 'balance_number'
+bool Tas5805mComponent::set_balance(float balance) {
+  this->tas5805m_balance_ = clamp(balance, -1.0f, 1.0f);
+  ESP_LOGV(TAG, "Balance: %3.2f", this->tas5805m_balance_);
+
+  // written with mixer mode by 'loop' if refresh of settings has not happened yet
+  if (!this->mixer_mode_configured_) return true;
+  return this->write_channel_volume_();
+}
+
+bool Tas5805mComponent::set_channel_volume(float left_db, float right_db) {
+  this->tas5805m_channel_volume_db_[0] = clamp(left_db, TAS5805M_MIN_CHANNEL_VOLUME_DB, TAS5805M_MAX_CHANNEL_VOLUME_DB);
+  this->tas5805m_channel_volume_db_[1] = clamp(right_db, TAS5805M_MIN_CHANNEL_VOLUME_DB, TAS5805M_MAX_CHANNEL_VOLUME_DB);
+  ESP_LOGV(TAG, "%s: L %3.1fdB R %3.1fdB", CHANNEL_VOLUME, this->tas5805m_channel_volume_db_[0], this->tas5805m_channel_volume_db_[1]);
+
+  // written with mixer mode by 'loop' if refresh of settings has not happened yet
+  if (!this->mixer_mode_configured_) return true;
+  return this->write_channel_volume_();
+}
+
+bool Tas5805mComponent::duck(float level_db, uint32_t attack, uint32_t release, uint32_t duration) {
+  this->wake();
+  float new_level = clamp(level_db, TAS5805M_MIN_CHANNEL_VOLUME_DB, 0.0f);
+  this->duck_release_ = release;
+
+  if (duration == 0) {
+    this->duck_holds_++;
+  } else {
+    // extend ducking until the last duck with a duration has ended
+    uint32_t hold_until = millis() + attack + duration;
+    if (!this->is_ducking() || ((int32_t)(hold_until - this->duck_hold_until_) > 0)) {
+      this->duck_hold_until_ = hold_until;
+    }
+    this->set_timeout("duck_hold", this->duck_hold_until_ - millis(), [this]() { this->check_duck_release_(); });
+  }
+
+  // deepest level of overlapping ducks is used
+  if (this->is_ducking() && (this->duck_phase_ != DUCK_RELEASE)) {
+    if (new_level >= this->duck_level_db_) return true;
+  }
+
+  ESP_LOGD(TAG, "Duck: %3.1fdB", new_level);
+  this->duck_level_db_ = new_level;
+  this->duck_phase_ = DUCK_ATTACK;
+  this->start_duck_ramp_(new_level, attack);
+  return true;
+}
+
+bool Tas5805mComponent::unduck() {
+  if (this->duck_holds_ > 0) this->duck_holds_--;
+  if (this->duck_phase_ == DUCK_HOLD) this->check_duck_release_();
+  return true;
+}
+
+// used by 'mixer_mode_select'
+bool Tas5805mComponent::set_mixer_mode(MixerMode mode) {
+  if (mode > LEFT) {
+    ESP_LOGW(TAG, "Invalid %s: %u", MIXER_MODE, (unsigned) mode);
+    return false;
+  }
+  if ((this->target_dac_mode_ == PBTL) && ((mode == STEREO) || (mode == STEREO_INVERSE))) {
+    ESP_LOGW(TAG, "%s %s not valid with PBTL", MIXER_MODE, MIXER_MODE_TEXT[mode]);
+    return false;
+  }
+  this->tas5805m_mixer_mode_ = mode;
+  this->mixer_mode_gains_(mode);
+  ESP_LOGD(TAG, "%s: %s", MIXER_MODE, MIXER_MODE_TEXT[mode]);
+  this->start_mixer_ramp_();
+  this->mixer_callback_.call();
+  return true;
+}
+
+// used by 'mixer_gain_number'
+bool Tas5805mComponent::set_mixer_gain(MixerPath path, float gain_db, bool invert) {
+  if (path > MIXER_RIGHT_TO_RIGHT) return false;
+  this->mixer_gain_db_[path] = clamp(gain_db, TAS5805M_MIN_MIXER_GAIN_DB, TAS5805M_MAX_MIXER_GAIN_DB);
+  this->mixer_invert_[path] = invert;
+  ESP_LOGV(TAG, "Mixer %s Gain: %s%3.1fdB", MIXER_PATH_TEXT[path], invert ? "inverted " : "", this->mixer_gain_db_[path]);
+  this->start_mixer_ramp_();
+  this->mixer_callback_.call();
+  return true;
+}
+
+bool Tas5805mComponent::set_mixer_matrix(float l_to_l_db, float r_to_l_db, float l_to_r_db, float r_to_r_db,
+                                         bool invert_l_to_l, bool invert_r_to_l,
+                                         bool invert_l_to_r, bool invert_r_to_r) {
+  const float gains_db[4] = {l_to_l_db, r_to_l_db, l_to_r_db, r_to_r_db};
+  const bool inverts[4] = {invert_l_to_l, invert_r_to_l, invert_l_to_r, invert_r_to_r};
+  for (uint8_t path = 0; path < 4; path++) {
+    this->mixer_gain_db_[path] = clamp(gains_db[path], TAS5805M_MIN_MIXER_GAIN_DB, TAS5805M_MAX_MIXER_GAIN_DB);
+    this->mixer_invert_[path] = inverts[path];
+  }
+  this->start_mixer_ramp_();
+  this->mixer_callback_.call();
+  return true;
+}
+
+// used by 'channel_volume_number'
+bool Tas5805mComponent::set_left_channel_volume(float volume_db) {
+  return this->set_channel_volume(volume_db, this->tas5805m_channel_volume_db_[1]);
+}
+
+bool Tas5805mComponent::set_right_channel_volume(float volume_db) {
+  return this->set_channel_volume(this->tas5805m_channel_volume_db_[0], volume_db);
+}
+
 // used by 'enable_dac_switch'
 void Tas5805mComponent::enable_dac(bool enable) {
+  this->reset_fault_recovery();
+  this->power_tier_ = POWER_TIER_NONE;
+  this->last_activity_ = millis();
   enable ? this->set_deep_sleep_off_() : this->set_deep_sleep_on_();
 }
 
+bool Tas5805mComponent::set_control_state(ControlState state) {
+  this->reset_fault_recovery();
+  this->power_tier_ = POWER_TIER_NONE;
+  this->last_activity_ = millis();
+  return this->start_sequence_(state, this->is_muted_);
+}
+
+// the channel fault latched by a lockout is cleared, otherwise the next fault poll
+// would read it again and restart fault recovery straight away
+void Tas5805mComponent::reset_fault_recovery() {
+  if ((this->recovery_state_ == RECOVERY_IDLE) && (this->recovery_retries_ == 0)) return;
+  this->cancel_timeout("fault_recovery");
+  this->recovery_state_ = RECOVERY_IDLE;
+  this->recovery_retries_ = 0;
+  this->publish_fault_recovery_();
+
+  if (!this->clear_fault_registers_()) {
+    ESP_LOGW(TAG, "%sclearing faults", ERROR);
+  }
+  this->tas5805m_faults_ = Tas5805mFault{};
+  this->is_fault_to_clear_ = false;
+  #ifdef USE_TAS5805M_BINARY_SENSOR
+  this->publish_faults_();
+  #endif
+  this->request_fault_check();
+}
+
+// mute and move to Hi-Z, then clear faults after a backoff which doubles for each retry in the window
+void Tas5805mComponent::start_fault_recovery_() {
+  uint32_t now = millis();
+  if ((this->recovery_retries_ == 0) || ((now - this->recovery_window_start_) > this->fault_recovery_window_)) {
+    this->recovery_retries_ = 0;
+    this->recovery_window_start_ = now;
+  }
+
+  // an idle power tier is left for the fault recovery
+  this->power_tier_ = POWER_TIER_NONE;
+  ControlState state = this->target_control_state_();
+  if (state > CTRL_HI_Z) this->recovery_return_state_ = state;
+
+  if (this->recovery_retries_ >= this->fault_recovery_max_retries_) {
+    this->recovery_state_ = RECOVERY_LOCKOUT;
+    this->recovery_lockouts_++;
+    ESP_LOGE(TAG, "Channel fault 0x%02X repeated %d times, locked out in Hi-Z",
+             this->tas5805m_faults_.channel_fault, this->recovery_retries_);
+    this->start_sequence_(CTRL_HI_Z, this->is_muted_);
+    this->publish_fault_recovery_();
+    return;
+  }
+
+  uint32_t backoff = this->fault_recovery_backoff_ << this->recovery_retries_;
+  this->recovery_retries_++;
+  this->recovery_state_ = RECOVERY_BACKOFF;
+  ESP_LOGW(TAG, "Channel fault 0x%02X, retry %d in %ums", this->tas5805m_faults_.channel_fault,
+           this->recovery_retries_, (unsigned) backoff);
+  this->start_sequence_(CTRL_HI_Z, this->is_muted_);
+  this->set_timeout("fault_recovery", backoff, [this]() { this->fault_recovery_retry_(); });
+  this->publish_fault_recovery_();
+}
+
+// volume is ramped back up by the pop free sequence
+void Tas5805mComponent::fault_recovery_retry_() {
+  this->recovery_state_ = RECOVERY_IDLE;
+  if (!this->clear_fault_registers_()) {
+    ESP_LOGW(TAG, "%sclearing faults", ERROR);
+  }
+  this->start_sequence_(this->recovery_return_state_, this->is_muted_);
+  this->request_fault_check();
+}
+
+void Tas5805mComponent::publish_fault_recovery_() {
+  #ifdef USE_TAS5805M_SENSOR
+  if (this->fault_recovery_retries_sensor_ != nullptr) {
+    this->fault_recovery_retries_sensor_->publish_state(this->recovery_retries_);
+  }
+  if (this->fault_recovery_lockouts_sensor_ != nullptr) {
+    this->fault_recovery_lockouts_sensor_->publish_state(this->recovery_lockouts_);
+  }
+  #endif
+}
+
+// wakes to play if the component entered an idle power tier
+bool Tas5805mComponent::wake() {
+  this->last_activity_ = millis();
+  if (this->power_tier_ == POWER_TIER_NONE) return true;
+
+  ESP_LOGD(TAG, "Wake from %s", POWER_TIER_TEXT[this->power_tier_]);
+  this->wake_tier_ = this->power_tier_;
+  this->wake_start_us_ = micros();
+  this->power_tier_ = POWER_TIER_NONE;
+  return this->start_sequence_(CTRL_PLAY, this->is_muted_);
+}
+
 // used by 'enable_eq_switch'
 bool Tas5805mComponent::enable_eq(bool enable) {
   #ifdef USE_TAS5805M_EQ
@@ -344,7 +816,7 @@ bool Tas5805mComponent::enable_eq(bool enable) {
 // used by eq gain numbers
 #ifdef USE_TAS5805M_EQ
 bool Tas5805mComponent::set_eq_gain(uint8_t band, int8_t gain) {
-  if (band < 0 || band >= NUMBER_EQ_BANDS) {
+  if (band >= NUMBER_EQ_BANDS) {
     ESP_LOGE(TAG, "Invalid %s%d", EQ_BAND, band);
     return false;
   }
@@ -356,13 +828,37 @@ bool Tas5805mComponent::set_eq_gain(uint8_t band, int8_t gain) {
   // EQ Gains initially set by tas5805 number component setups
   if (!this->refresh_settings_triggered_) {
     this->tas5805m_eq_gain_[band] = gain;
+    this->update_output_latency_();
     return true;
   }
 
   // runs when 'refresh_settings_triggered_' is true
 
   ESP_LOGV(TAG, "Set %s%d Gain: %ddB", EQ_BAND, band, gain);
+  this->tas5805m_eq_gain_[band] = gain;
+  this->update_output_latency_();
+
+  // written when dsp is running again
+  if (!this->is_dsp_retained_()) {
+    this->eq_bands_lost_ |= (1 << band);
+    this->mark_dsp_lost_(DSP_BLOCK_EQ);
+    return true;
+  }
+
+  uint8_t x = (gain + TAS5805M_EQ_MAX_DB);
+  const RegisterSequenceEq* reg_value = &TAS5805M_EQ_REGISTERS[x][band];
+  if(!this->set_book_and_page_(TAS5805M_REG_BOOK_EQ, reg_value->page)) {
+    ESP_LOGE(TAG, "%s%s%d @ page 0x%02X", ERROR, EQ_BAND, band, reg_value->page);
+    return false;
+  }
+
+  uint8_t current_page = reg_value->page;
+  if (!this->write_eq_band_(band, gain, &current_page)) return false;
+
+  return this->set_book_and_page_(TAS5805M_REG_BOOK_CONTROL_PORT, TAS5805M_REG_PAGE_ZERO);
+}
 
+bool Tas5805mComponent::write_eq_band_(uint8_t band, int8_t gain, uint8_t* current_page) {
   uint8_t x = (gain + TAS5805M_EQ_MAX_DB);
 
   const RegisterSequenceEq* reg_value = &TAS5805M_EQ_REGISTERS[x][band];
@@ -370,49 +866,55 @@ bool Tas5805mComponent::set_eq_gain(uint8_t band, int8_t gain) {
     ESP_LOGE(TAG, "%sNULL@eq_registers[%d][%d]",ERROR, x, band);
     return false;
   }
+  return this->write_eq_coefficients_(band, reg_value, current_page);
+}
 
-  if(!this->set_book_and_page_(TAS5805M_REG_BOOK_EQ, reg_value->page)) {
-    ESP_LOGE(TAG, "%s%s%d @ page 0x%02X", ERROR, EQ_BAND, band, reg_value->page);
-    return false;
+bool Tas5805mComponent::write_eq_coefficients_(uint8_t band, const RegisterSequenceEq* reg_value, uint8_t* current_page) {
+  if (*current_page != reg_value->page) {
+    if (!this->tas5805m_write_byte_(TAS5805M_REG_PAGE_SET, reg_value->page)) {
+      ESP_LOGE(TAG, "%s%s%d @ page 0x%02X", ERROR, EQ_BAND, band, reg_value->page);
+      return false;
+    }
+    *current_page = reg_value->page;
   }
 
   if(!this->tas5805m_write_bytes_(reg_value->offset1, const_cast<uint8_t *>(reg_value->value), reg_value->bytes_in_block1)) {
     ESP_LOGE(TAG, "%s%s%d Gain: offset 0x%02X for %d bytes", ERROR, EQ_BAND, band, reg_value->offset1, reg_value->bytes_in_block1);
+    return false;
   }
 
   uint8_t bytes_in_block2 = COEFFICENTS_PER_EQ_BAND - reg_value->bytes_in_block1;
   if (bytes_in_block2 != 0) {
     uint8_t next_page = reg_value->page + 1;
-    if(!this->set_book_and_page_(TAS5805M_REG_BOOK_EQ, next_page)) {
+    if (!this->tas5805m_write_byte_(TAS5805M_REG_PAGE_SET, next_page)) {
       ESP_LOGE(TAG, "%s%s%d @ page 0x%02X", ERROR, EQ_BAND, band, next_page);
       return false;
     }
+    *current_page = next_page;
     if(!this->tas5805m_write_bytes_(reg_value->offset2, const_cast<uint8_t *>(reg_value->value + reg_value->bytes_in_block1), bytes_in_block2)) {
       ESP_LOGE(TAG, "%s%s%d Gain: offset 0x%02X for %d bytes", ERROR, EQ_BAND, band, reg_value->offset2, bytes_in_block2);
       return false;
     }
   }
-
-  return this->set_book_and_page_(TAS5805M_REG_BOOK_CONTROL_PORT, TAS5805M_REG_PAGE_ZERO);
+  return true;
 }
 #endif
 
 bool Tas5805mComponent::set_mute_off() {
+  this->wake();
   if (!this->is_muted_) return true;
-  if (!this->tas5805m_write_byte_(TAS5805M_DEVICE_CTRL_2, this->tas5805m_control_state_)) return false;
   this->is_muted_ = false;
   ESP_LOGV(TAG, "Mute Off");
-  return true;
+  return this->start_sequence_(this->target_control_state_(), false);
 }
 
 // set bit 3 MUTE in TAS5805M_DEVICE_CTRL_2 and retain current Control State
 // ensures get_state = get_power_state
 bool Tas5805mComponent::set_mute_on() {
   if (this->is_muted_) return true;
-  if (!this->tas5805m_write_byte_(TAS5805M_DEVICE_CTRL_2, this->tas5805m_control_state_ + TAS5805M_MUTE_CONTROL)) return false;
   this->is_muted_ = true;
   ESP_LOGV(TAG, "Mute On");
-  return true;
+  return this->start_sequence_(this->target_control_state_(), true);
 }
 
 // used by 'enable_eq_switch' and 'eq_gain_band16000hz'
@@ -426,6 +928,7 @@ void Tas5805mComponent::refresh_settings() {
   // 'refresh_settings_triggered_' remains true once refresh of settings has completed
   // which allows 'set_eq_gains' continue to write eq gains
   this->refresh_settings_triggered_ = true;
+  this->refresh_triggered_time_ = millis();
 
   #ifdef USE_TAS5805M_EQ
   ESP_LOGD(TAG, "Refresh triggered: EQ %s", this->tas5805m_eq_enabled_ ? "Enabled" : "Disabled");
@@ -438,6 +941,36 @@ uint32_t Tas5805mComponent::times_faults_cleared() {
   return this->times_faults_cleared_;
 }
 
+const Tas5805mFaultEvent* Tas5805mComponent::fault_event(uint8_t index) {
+  if (index >= this->fault_event_count_) return nullptr;
+  uint8_t position = (this->fault_event_head_ + FAULT_EVENT_HISTORY_SIZE - 1 - index) % FAULT_EVENT_HISTORY_SIZE;
+  return &this->fault_events_[position];
+}
+
+void Tas5805mComponent::clear_fault_events() {
+  // an active event is kept so its end is still recorded
+  Tas5805mFaultEvent* active = this->active_fault_event_();
+  Tas5805mFaultEvent kept;
+  if (active != nullptr) kept = *active;
+
+  this->fault_event_head_ = 0;
+  this->fault_event_count_ = 0;
+  if (active != nullptr) {
+    this->fault_events_[0] = kept;
+    this->fault_event_head_ = 1;
+    this->fault_event_count_ = 1;
+  }
+}
+
+void Tas5805mComponent::dump_fault_events() {
+  ESP_LOGI(TAG, "Fault Events: %d (oldest first)", this->fault_event_count_);
+  char buffer[96];
+  for (uint8_t i = this->fault_event_count_; i > 0; i--) {
+    this->format_fault_event_(this->fault_event(i - 1), buffer, sizeof(buffer));
+    ESP_LOGI(TAG, "  %s", buffer);
+  }
+}
+
 // used by 'eq_gain_band16000hz' to determine if it should 'refresh_settings()'
 bool Tas5805mComponent::use_eq_gain_refresh() {
   return (this->auto_refresh_ == AutoRefreshMode::BY_GAIN);
@@ -448,9 +981,14 @@ bool Tas5805mComponent::use_eq_switch_refresh() {
   return (this->auto_refresh_ == AutoRefreshMode::BY_SWITCH);
 }
 
+// a sequence ramps the digital volume down to mute, the volume restored at its end is reported
 float Tas5805mComponent::volume() {
   uint8_t raw_volume;
-  this->get_digital_volume_(&raw_volume);
+  if (this->is_sequence_running()) {
+    raw_volume = this->sequence_restore_raw_volume_;
+  } else {
+    this->get_digital_volume_(&raw_volume);
+  }
 
   return remap<float, uint8_t>(raw_volume, this->tas5805m_raw_volume_min_,
                                            this->tas5805m_raw_volume_max_,
@@ -458,112 +996,374 @@ float Tas5805mComponent::volume() {
 }
 
 bool Tas5805mComponent::set_volume(float volume) {
+  this->wake();
+
+  // a new volume overrides any fade in progress and restores configured volume ramp
+  this->cancel_fade_();
+  if (!this->set_volume_ramp_(this->tas5805m_volume_ramp_)) return false;
+
   float new_volume = clamp(volume, 0.0f, 1.0f);
   uint8_t raw_volume = remap<uint8_t, float>(new_volume, 0.0f, 1.0f,
                                                          this->tas5805m_raw_volume_min_,
                                                          this->tas5805m_raw_volume_max_);
+
+  // volume is restored by the end of a pop free sequence in progress
+  if (this->is_sequence_running()) {
+    this->sequence_restore_raw_volume_ = raw_volume;
+    return true;
+  }
+
   if (!this->set_digital_volume_(raw_volume)) return false;
   #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
     int8_t dB = -(raw_volume / 2) + 24;
     ESP_LOGV(TAG, "Volume: %idB", dB);
   #endif
+
+  // louder output can trip over current faults
+  this->request_fault_check();
   return true;
 }
 
 
-// protected
+// staged settings are resolved to register values here so the commit only writes them
+void Tas5805mComponent::stage_volume(float volume) {
+  this->staged_raw_volume_ = remap<uint8_t, float>(clamp(volume, 0.0f, 1.0f), 0.0f, 1.0f,
+                                                   this->tas5805m_raw_volume_min_,
+                                                   this->tas5805m_raw_volume_max_);
+  this->staged_volume_set_ = true;
+}
 
-bool Tas5805mComponent::get_analog_gain_(uint8_t* raw_gain) {
-  uint8_t current;
-  if (!this->tas5805m_read_byte_(TAS5805M_AGAIN, &current)) return false;
-  // remove top 3 reserved bits
-  *raw_gain = current & 0x1F;
+#ifdef USE_TAS5805M_EQ
+bool Tas5805mComponent::stage_eq_gain(uint8_t band, int8_t gain) {
+  if (band >= NUMBER_EQ_BANDS) {
+    ESP_LOGE(TAG, "Invalid %s%d", EQ_BAND, band);
+    return false;
+  }
+  if (gain < TAS5805M_EQ_MIN_DB || gain > TAS5805M_EQ_MAX_DB) {
+    ESP_LOGE(TAG, "Invalid %s%d Gain: %ddB", EQ_BAND, band, gain);
+    return false;
+  }
+  this->staged_eq_gain_[band] = gain;
+  this->staged_eq_registers_[band] = &TAS5805M_EQ_REGISTERS[gain + TAS5805M_EQ_MAX_DB][band];
+  this->staged_eq_bands_ |= (1 << band);
   return true;
 }
+#endif
 
-// Analog Gain Control , with 0.5dB one step
-// lower 5 bits controls the analog gain.
-// 00000: 0 dB (29.5V peak voltage)
-// 00001: -0.5db
-// 11111: -15.5 dB
-// set analog gain in dB
-bool Tas5805mComponent::set_analog_gain_(float gain_db) {
-  if ((gain_db < TAS5805M_MIN_ANALOG_GAIN) || (gain_db > TAS5805M_MAX_ANALOG_GAIN)) return false;
-
-  uint8_t new_again = static_cast<uint8_t>(-gain_db * 2.0);
-
-  uint8_t current_again;
-  if (!this->tas5805m_read_byte_(TAS5805M_AGAIN, &current_again)) return false;
-
-  // keep top 3 reserved bits combine with bottom 5 analog gain bits
-  new_again = (current_again & 0xE0) | new_again;
-  if (!this->tas5805m_write_byte_(TAS5805M_AGAIN, new_again)) return false;
-
-  ESP_LOGD(TAG, "Analog Gain: %fdB", gain_db);
+// a commit time already passed is committed now
+bool Tas5805mComponent::commit_staged_at(uint64_t commit_time) {
+  int64_t lead_time = (int64_t) commit_time - epoch_ms();
+  if (lead_time > MAX_COMMIT_LEAD_TIME) {
+    ESP_LOGW(TAG, "Commit time %us ahead, system clock not synchronised", (unsigned) (lead_time / 1000));
+    return false;
+  }
+  this->staged_commit_time_ = commit_time;
+  this->wait_for_commit_time_();
   return true;
 }
 
-bool Tas5805mComponent::get_dac_mode_(DacMode* mode) {
-    uint8_t current_value;
-    if (!this->tas5805m_read_byte_(TAS5805M_DEVICE_CTRL_1, &current_value)) return false;
-    if (current_value & (1 << 2)) {
-        *mode = PBTL;
-    } else {
-        *mode = BTL;
-    }
-    this->tas5805m_dac_mode_ = *mode;
-    return true;
+void Tas5805mComponent::cancel_staged() {
+  this->cancel_timeout("commit");
+  this->staged_commit_time_ = 0;
+  this->staged_volume_set_ = false;
+  #ifdef USE_TAS5805M_EQ
+  this->staged_eq_bands_ = 0;
+  #endif
 }
 
-// only runs once from 'setup'
-bool Tas5805mComponent::set_dac_mode_(DacMode mode) {
-  uint8_t current_value;
-  if (!this->tas5805m_read_byte_(TAS5805M_DEVICE_CTRL_1, &current_value)) return false;
+// the system clock is checked again when the timeout runs since sntp can adjust it
+// while waiting, so the commit is never early
+void Tas5805mComponent::wait_for_commit_time_() {
+  int64_t lead_time = (int64_t) this->staged_commit_time_ - epoch_ms();
+  if (lead_time > 0) {
+    this->set_timeout("commit", (uint32_t) lead_time, [this]() { this->wait_for_commit_time_(); });
+    return;
+  }
+  if (-lead_time > MAX_COMMIT_LEAD_TIME) {
+    ESP_LOGW(TAG, "Staged changes committed %us late", (unsigned) (-lead_time / 1000));
+  } else if (-lead_time > COMMIT_LATE_WARNING) {
+    ESP_LOGW(TAG, "Staged changes committed %ums late", (unsigned) -lead_time);
+  }
+  this->commit_staged_();
+}
 
-  // Update bit 2 based on the mode
-  if (mode == PBTL) {
-      current_value |= (1 << 2);  // Set bit 2 to 1 (PBTL mode)
-  } else {
-      current_value &= ~(1 << 2); // Clear bit 2 to 0 (BTL mode)
+// staged eq bands and volume are written in one burst of register writes, eq bands with one book
+// selection and the volume straight after returning to the control port, so all staged changes reach
+// the tas5805m within a few ms of each other
+// the volume is written as it is, the commit does not wake the tas5805m or change a fade in progress
+void Tas5805mComponent::commit_staged_() {
+  uint32_t start = micros();
+  this->staged_commit_time_ = 0;
+
+  bool volume_set = this->staged_volume_set_;
+  this->staged_volume_set_ = false;
+  // volume is restored by the end of a pop free sequence in progress
+  if (volume_set && this->is_sequence_running()) {
+    this->sequence_restore_raw_volume_ = this->staged_raw_volume_;
+    volume_set = false;
   }
-  if (!this->tas5805m_write_byte_(TAS5805M_DEVICE_CTRL_1, current_value)) return false;
 
-  // 'tas5805m_state_' global already has dac mode from YAML config
-  // save anyway so 'set_dac_mode' could be used more generally
-  this->tas5805m_dac_mode_ = mode;
-  ESP_LOGD(TAG, "DAC mode: %s", this->tas5805m_dac_mode_ ? "PBTL" : "BTL");
+  bool ok = true;
+  #ifdef USE_TAS5805M_EQ
+  uint16_t bands = this->staged_eq_bands_;
+  this->staged_eq_bands_ = 0;
+  if (bands != 0) {
+    // before refresh or while the dsp is not running gains are stored or deferred
+    if (!this->refresh_settings_triggered_ || !this->is_dsp_retained_()) {
+      for (uint8_t band = 0; band < NUMBER_EQ_BANDS; band++) {
+        if (bands & (1 << band)) this->set_eq_gain(band, this->staged_eq_gain_[band]);
+      }
+    } else {
+      uint8_t current_page = 0;
+      ok = this->set_book_and_page_(TAS5805M_REG_BOOK_EQ, current_page);
+      for (uint8_t band = 0; ok && (band < NUMBER_EQ_BANDS); band++) {
+        if (!(bands & (1 << band))) continue;
+        this->tas5805m_eq_gain_[band] = this->staged_eq_gain_[band];
+        ok = this->write_eq_coefficients_(band, this->staged_eq_registers_[band], &current_page);
+      }
+      ok = this->set_book_and_page_(TAS5805M_REG_BOOK_CONTROL_PORT, TAS5805M_REG_PAGE_ZERO) && ok;
+      this->update_output_latency_();
+    }
+  }
+  #endif
+
+  if (volume_set) ok = this->set_digital_volume_(this->staged_raw_volume_) && ok;
+
+  if (!ok) {
+    ESP_LOGE(TAG, "%scommitting staged changes", ERROR);
+    return;
+  }
+  ESP_LOGD(TAG, "Staged changes committed in %uus", (unsigned) (micros() - start));
+}
+
+// hardware ramp time in microseconds for 'raw_delta' 0.5dB volume steps
+static uint32_t volume_ramp_time_us(uint16_t raw_delta, uint8_t rate, uint8_t step) {
+  static const uint8_t RAMP_FS_PERIODS[3] = {1, 2, 4};   // indexed by VolumeRampRate
+  static const uint8_t RAMP_HALF_DB[4]    = {8, 4, 2, 1}; // indexed by VolumeRampStep
+  uint32_t updates = (raw_delta + RAMP_HALF_DB[step] - 1) / RAMP_HALF_DB[step];
+  return (updates * RAMP_FS_PERIODS[rate] * 1000000UL) / VOLUME_RAMP_SAMPLE_RATE;
+}
+
+bool Tas5805mComponent::fade_to(float volume, uint32_t duration) {
+  this->wake();
+  this->cancel_fade_();
+
+  float new_volume = clamp(volume, 0.0f, 1.0f);
+  uint8_t target_raw = remap<uint8_t, float>(new_volume, 0.0f, 1.0f,
+                                                         this->tas5805m_raw_volume_min_,
+                                                         this->tas5805m_raw_volume_max_);
+  // volume is restored by the end of a pop free sequence in progress
+  if (this->is_sequence_running()) {
+    this->sequence_restore_raw_volume_ = target_raw;
+    return true;
+  }
+
+  uint16_t raw_delta = abs(target_raw - this->tas5805m_raw_volume_);
+  if (raw_delta == 0) return true;
+
+  uint64_t duration_us = (uint64_t) duration * 1000;
+  uint32_t slowest_ramp_us = volume_ramp_time_us(raw_delta, RAMP_RATE_4FS, RAMP_STEP_0_5DB);
+
+  // hardware ramp can cover whole fade so choose the ramp closest to the requested duration
+  // and fade with a single volume write
+  if (duration_us <= slowest_ramp_us) {
+    uint8_t best_rate = RAMP_RATE_1FS;
+    uint8_t best_step = RAMP_STEP_4DB;
+    uint32_t best_error = UINT32_MAX;
+    for (uint8_t rate = RAMP_RATE_1FS; rate <= RAMP_RATE_4FS; rate++) {
+      for (uint8_t step = RAMP_STEP_4DB; step <= RAMP_STEP_0_5DB; step++) {
+        uint32_t ramp_us = volume_ramp_time_us(raw_delta, rate, step);
+        uint32_t error = (ramp_us > duration_us) ? (ramp_us - duration_us) : (duration_us - ramp_us);
+        if (error < best_error) {
+          best_error = error;
+          best_rate = rate;
+          best_step = step;
+        }
+      }
+    }
+    if (!this->set_volume_ramp_((best_rate << 6) | (best_step << 4) | (best_rate << 2) | best_step)) return false;
+    ESP_LOGV(TAG, "Fade: single write over %uus", volume_ramp_time_us(raw_delta, best_rate, best_step));
+    if (!this->set_digital_volume_(target_raw)) return false;
+
+    // louder output can trip over current faults
+    this->request_fault_check();
+    return true;
+  }
+
+  // fade is longer than the hardware ramp so use evenly spaced volume writes
+  // each write is smoothed by the slowest hardware ramp so there is no audible stepping
+  uint8_t slowest_ramp = (RAMP_RATE_4FS << 6) | (RAMP_STEP_0_5DB << 4) | (RAMP_RATE_4FS << 2) | RAMP_STEP_0_5DB;
+  if (!this->set_volume_ramp_(slowest_ramp)) return false;
+
+  uint32_t steps = std::max<uint32_t>(1, std::min<uint32_t>(raw_delta, duration / FADE_MIN_STEP_INTERVAL));
+  this->fade_start_raw_ = this->tas5805m_raw_volume_;
+  this->fade_target_raw_ = target_raw;
+  this->fade_steps_ = steps;
+  this->fade_step_index_ = 0;
+  ESP_LOGV(TAG, "Fade: %u writes every %ums", steps, duration / steps);
+  this->set_interval("fade", duration / steps, [this]() { this->fade_step_(); });
   return true;
 }
 
-bool Tas5805mComponent::set_deep_sleep_off_() {
-  if (this->tas5805m_control_state_ != CTRL_DEEP_SLEEP) return true; // already not in deep sleep
-  // preserve mute state
-  uint8_t new_value = (this->is_muted_) ? (CTRL_PLAY + TAS5805M_MUTE_CONTROL) : CTRL_PLAY;
-  if (!this->tas5805m_write_byte_(TAS5805M_DEVICE_CTRL_2, new_value)) return false;
 
-  this->tas5805m_control_state_ = CTRL_PLAY;                        // set Control State to play
-  ESP_LOGV(TAG, "Deep Sleep Off");
-  #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
-  if (this->is_muted_) ESP_LOGV(TAG, "Mute On preserved");
-  #endif
+// protected
+
+void Tas5805mComponent::fade_step_() {
+  if (this->fade_steps_ == 0) return;
+  this->fade_step_index_++;
+
+  int16_t raw_delta = this->fade_target_raw_ - this->fade_start_raw_;
+  uint8_t raw_volume = this->fade_start_raw_ + (raw_delta * this->fade_step_index_) / this->fade_steps_;
+  if (!this->set_digital_volume_(raw_volume)) {
+    ESP_LOGW(TAG, "%sfading volume", ERROR);
+  } else if (raw_delta < 0) {
+    // louder output can trip over current faults
+    this->request_fault_check();
+  }
+
+  if (this->fade_step_index_ >= this->fade_steps_) {
+    this->cancel_fade_();
+  }
+}
+
+void Tas5805mComponent::cancel_fade_() {
+  if (this->fade_steps_ == 0) return;
+  this->cancel_interval("fade");
+  this->fade_steps_ = 0;
+}
+
+bool Tas5805mComponent::get_analog_gain_(uint8_t* raw_gain) {
+  uint8_t current;
+  if (!this->tas5805m_read_byte_(TAS5805M_AGAIN, &current)) return false;
+  // remove top 3 reserved bits
+  *raw_gain = current & 0x1F;
   return true;
 }
 
-bool Tas5805mComponent::set_deep_sleep_on_() {
-  if (this->tas5805m_control_state_ == CTRL_DEEP_SLEEP) return true; // already in deep sleep
+// Analog Gain Control , with 0.5dB one step
+// lower 5 bits controls the analog gain.
+// 00000: 0 dB (29.5V peak voltage)
+// 00001: -0.5db
+// 11111: -15.5 dB
+// set analog gain in dB
+bool Tas5805mComponent::set_analog_gain_(float gain_db) {
+  if ((gain_db < TAS5805M_MIN_ANALOG_GAIN) || (gain_db > TAS5805M_MAX_ANALOG_GAIN)) return false;
 
-  // preserve mute state
-  uint8_t new_value = (this->is_muted_) ? (CTRL_DEEP_SLEEP + TAS5805M_MUTE_CONTROL) : CTRL_DEEP_SLEEP;
-  if (!this->tas5805m_write_byte_(TAS5805M_DEVICE_CTRL_2, new_value)) return false;
+  uint8_t new_again = static_cast<uint8_t>(-gain_db * 2.0);
 
-  this->tas5805m_control_state_ = CTRL_DEEP_SLEEP;                   // set Control State to deep sleep
-  ESP_LOGV(TAG, "Deep Sleep On");
-  #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
-  if (this->is_muted_) ESP_LOGD(TAG, "Mute On preserved");
-  #endif
+  uint8_t current_again;
+  if (!this->tas5805m_read_byte_(TAS5805M_AGAIN, &current_again)) return false;
+
+  // keep top 3 reserved bits combine with bottom 5 analog gain bits
+  new_again = (current_again & 0xE0) | new_again;
+  if (!this->tas5805m_write_byte_(TAS5805M_AGAIN, new_again)) return false;
+
+  this->tas5805m_analog_gain_ = gain_db;
+  ESP_LOGD(TAG, "Analog Gain: %fdB", gain_db);
+  return true;
+}
+
+bool Tas5805mComponent::get_dac_mode_(DacMode* mode) {
+    uint8_t current_value;
+    if (!this->tas5805m_read_byte_(TAS5805M_DEVICE_CTRL_1, &current_value)) return false;
+    if (current_value & (1 << 2)) {
+        *mode = PBTL;
+    } else {
+        *mode = BTL;
+    }
+    this->tas5805m_dac_mode_ = *mode;
+    return true;
+}
+
+// runs from 'setup' and from pop free sequencer when in Hi-Z
+// bits 6:4 switching frequency, bit 2 PBTL, bits 1:0 modulation mode, other bits reserved as 0
+bool Tas5805mComponent::write_device_ctrl_1_(SwitchingFrequency fsw, DacMode mode, ModulationMode modulation) {
+  uint8_t value = (fsw << 4) | modulation;
+  if (mode == PBTL) value |= TAS5805M_DAMP_PBTL;
+  if (!this->tas5805m_write_byte_(TAS5805M_DEVICE_CTRL_1, value)) return false;
+
+  this->tas5805m_switching_frequency_ = fsw;
+  this->tas5805m_dac_mode_ = mode;
+  this->tas5805m_modulation_mode_ = modulation;
+  ESP_LOGD(TAG, "DAC mode: %s, Modulation: %s, Switching Frequency: %ukHz",
+           this->tas5805m_dac_mode_ ? "PBTL" : "BTL", MODULATION_MODE_TEXT[modulation],
+           switching_frequency_khz(fsw));
+  return true;
+}
+
+// data offset counts bck cycles from the start of the frame, so each amp on a shared
+// TDM data line reads its own pair of slots
+bool Tas5805mComponent::write_serial_audio_port_() {
+  uint16_t offset = 0;
+  if (this->serial_format_ == FORMAT_TDM) {
+    offset = this->tdm_slot_ * WORD_LENGTH_BITS[this->word_length_];
+    if (offset > TAS5805M_MAX_SAP_OFFSET) {
+      ESP_LOGE(TAG, "TDM slot %u data offset out of range", this->tdm_slot_);
+      return false;
+    }
+  }
+  uint8_t sap_ctrl1 = (this->serial_format_ << 4) | this->word_length_;
+  if (offset > 0xFF) sap_ctrl1 |= TAS5805M_SAP_OFFSET_MSB;
+  if (!this->tas5805m_write_byte_(TAS5805M_SAP_CTRL1, sap_ctrl1)) return false;
+  if (!this->tas5805m_write_byte_(TAS5805M_SAP_CTRL2, (uint8_t)(offset & 0xFF))) return false;
+  ESP_LOGD(TAG, "I2S Format: %s, Word Length: %ubit, Data Offset: %u",
+           SERIAL_FORMAT_TEXT[this->serial_format_], WORD_LENGTH_BITS[this->word_length_], offset);
   return true;
 }
 
+// used by 'dac_mode_select'
+bool Tas5805mComponent::set_dac_mode(DacMode mode) {
+  if (mode == this->target_dac_mode_) return true;
+
+  // same mixer mode validation as YAML config
+  if ((mode == PBTL) && ((this->tas5805m_mixer_mode_ == STEREO) || (this->tas5805m_mixer_mode_ == STEREO_INVERSE))) {
+    ESP_LOGW(TAG, "DAC mode: PBTL must have %s: MONO or RIGHT or LEFT", MIXER_MODE);
+    return false;
+  }
+  this->target_dac_mode_ = mode;
+  this->reconfigure_pending_ = true;
+  return this->start_sequence_(this->target_control_state_(), this->is_muted_);
+}
+
+bool Tas5805mComponent::set_switching_frequency(SwitchingFrequency fsw) {
+  if (fsw == this->target_switching_frequency_) return true;
+  this->target_switching_frequency_ = fsw;
+  this->reconfigure_pending_ = true;
+  return this->start_sequence_(this->target_control_state_(), this->is_muted_);
+}
+
+bool Tas5805mComponent::set_modulation_mode(ModulationMode modulation) {
+  if (modulation > MOD_HYBRID) return false;
+  if (modulation == this->target_modulation_mode_) return true;
+  this->target_modulation_mode_ = modulation;
+  this->reconfigure_pending_ = true;
+  return this->start_sequence_(this->target_control_state_(), this->is_muted_);
+}
+
+// used by 'analog_gain_number'
+bool Tas5805mComponent::set_analog_gain(float gain_db) {
+  // analog gain is in 0.5dB steps
+  float new_gain = roundf(clamp(gain_db, TAS5805M_MIN_ANALOG_GAIN, TAS5805M_MAX_ANALOG_GAIN) * 2.0f) / 2.0f;
+  if (new_gain == this->target_analog_gain_) return true;
+
+  this->target_analog_gain_ = new_gain;
+  this->reconfigure_pending_ = true;
+  return this->start_sequence_(this->target_control_state_(), this->is_muted_);
+}
+
+// deep sleep on and off use the pop free sequencer and preserve mute state
+bool Tas5805mComponent::set_deep_sleep_off_() {
+  if (this->target_control_state_() != CTRL_DEEP_SLEEP) return true; // already not in deep sleep
+  ESP_LOGV(TAG, "Deep Sleep Off");
+  return this->start_sequence_(CTRL_PLAY, this->is_muted_);
+}
+
+bool Tas5805mComponent::set_deep_sleep_on_() {
+  if (this->target_control_state_() == CTRL_DEEP_SLEEP) return true; // already in deep sleep
+  ESP_LOGV(TAG, "Deep Sleep On");
+  return this->start_sequence_(CTRL_DEEP_SLEEP, this->is_muted_);
+}
+
 bool Tas5805mComponent::get_digital_volume_(uint8_t* raw_volume) {
   uint8_t current = 254; // lowest raw volume
   if(!this->tas5805m_read_byte_(TAS5805M_DIG_VOL_CTRL, &current)) return false;
@@ -582,9 +1382,306 @@ bool Tas5805mComponent::get_digital_volume_(uint8_t* raw_volume) {
 // 11111111: Mute
 bool Tas5805mComponent::set_digital_volume_(uint8_t raw_volume) {
   if (!this->tas5805m_write_byte_(TAS5805M_DIG_VOL_CTRL, raw_volume)) return false;
+  this->tas5805m_raw_volume_ = raw_volume;
   return true;
 }
 
+// same ramp rate and step is used for ramping volume up and down
+// only written if different to last ramp written
+bool Tas5805mComponent::set_volume_ramp_(uint8_t volume_ramp) {
+  if (this->tas5805m_current_volume_ramp_ == volume_ramp) return true;
+  if (!this->tas5805m_write_byte_(TAS5805M_DIG_VOL_CTRL2, volume_ramp)) return false;
+  this->tas5805m_current_volume_ramp_ = volume_ramp;
+  return true;
+}
+
+// converts linear gain to the big endian 9.23 format used by tas5805m dsp coefficients
+static void gain_to_9_23(float gain, uint8_t* data) {
+  double scaled = round(static_cast<double>(gain) * 8388608.0);  // 2^23
+  scaled = clamp(scaled, -2147483648.0, 2147483647.0);
+  uint32_t value = static_cast<uint32_t>(static_cast<int32_t>(scaled));
+  data[0] = (uint8_t)(value >> 24);
+  data[1] = (uint8_t)(value >> 16);
+  data[2] = (uint8_t)(value >> 8);
+  data[3] = (uint8_t)(value);
+}
+
+// balance attenuates the opposite channel linearly, full balance mutes it
+void Tas5805mComponent::channel_volume_words_(uint8_t* words) {
+  float gain_db = this->duck_gain_db_ + this->thermal_gain_db_;
+  float left_gain = powf(10.0f, (this->tas5805m_channel_volume_db_[0] + gain_db) / 20.0f);
+  float right_gain = powf(10.0f, (this->tas5805m_channel_volume_db_[1] + gain_db) / 20.0f);
+  if (this->tas5805m_balance_ > 0.0f) left_gain *= (1.0f - this->tas5805m_balance_);
+  if (this->tas5805m_balance_ < 0.0f) right_gain *= (1.0f + this->tas5805m_balance_);
+
+  gain_to_9_23(left_gain, words);
+  gain_to_9_23(right_gain, words + (TAS5805M_REG_RIGHT_VOLUME - TAS5805M_REG_LEFT_VOLUME));
+}
+
+bool Tas5805mComponent::write_channel_volume_() {
+  if (!this->is_dsp_retained_()) {
+    this->mark_dsp_lost_(DSP_BLOCK_VOLUME);
+    return true;
+  }
+
+  uint8_t volume_words[8];
+  this->channel_volume_words_(volume_words);
+
+  if (!this->set_book_and_page_(TAS5805M_REG_BOOK_5, TAS5805M_REG_BOOK_5_VOLUME_PAGE)) {
+    ESP_LOGE(TAG, "%s begin Set %s", ERROR, CHANNEL_VOLUME);
+    return false;
+  }
+
+  if (!this->tas5805m_write_bytes_(TAS5805M_REG_LEFT_VOLUME, volume_words, 8)) {
+    ESP_LOGE(TAG, "%s %s words", ERROR, CHANNEL_VOLUME);
+    return false;
+  }
+
+  if (!this->set_book_and_page_(TAS5805M_REG_BOOK_CONTROL_PORT, TAS5805M_REG_PAGE_ZERO)) {
+    ESP_LOGE(TAG, "%s end Set %s", ERROR, CHANNEL_VOLUME);
+    return false;
+  }
+  return true;
+}
+
+// clock fault bit is already read with the fault registers, FS_MON and BCK_MON
+// are only read when sample rate or bck ratio sensors are configured
+void Tas5805mComponent::update_clock_health_() {
+  if (this->tas5805m_faults_.clock_fault && !this->clock_fault_seen_) this->record_clock_glitch_();
+  this->clock_fault_seen_ = this->tas5805m_faults_.clock_fault;
+
+  // an ignored clock fault is otherwise never cleared, so it is cleared here for the next glitch to be seen
+  // a clock that stays missing latches it again, which is not a new glitch
+  // with other faults latched, clearing is left to the next fault poll
+  if (this->tas5805m_faults_.clock_fault && this->ignore_clock_faults_when_clearing_faults_ &&
+      !this->tas5805m_faults_.is_fault_except_clock_fault) {
+    if (!this->tas5805m_write_byte_(TAS5805M_FAULT_CLEAR, TAS5805M_ANALOG_FAULT_CLEAR)) {
+      ESP_LOGW(TAG, "%sclearing clock fault", ERROR);
+    }
+  }
+
+  if (this->is_clock_monitor_used_()) {
+    uint8_t monitor[2];
+    if (!this->tas5805m_read_bytes_(TAS5805M_FS_MON, monitor, 2)) {
+      ESP_LOGW(TAG, "%sreading clock monitor", ERROR);
+    } else {
+      uint32_t sample_rate = fs_mon_sample_rate(monitor[0]);
+      if ((sample_rate == 0) && (this->clock_sample_rate_ != 0) && !this->tas5805m_faults_.clock_fault) {
+        this->record_clock_glitch_();
+      }
+      bool sample_rate_changed = (sample_rate != this->clock_sample_rate_);
+      this->clock_sample_rate_ = sample_rate;
+      if (sample_rate_changed) this->update_output_latency_();
+      this->clock_bck_ratio_ = ((monitor[0] & TAS5805M_FS_MON_BCK_RATIO_MASK) << 4) | monitor[1];
+    }
+  }
+  this->publish_clock_health_();
+}
+
+void Tas5805mComponent::record_clock_glitch_() {
+  uint32_t now = millis();
+  if (this->clock_glitches_ == 0) this->first_clock_glitch_ = now;
+  this->clock_glitches_++;
+  this->clock_glitch_times_[this->clock_glitch_head_] = now;
+  this->clock_glitch_head_ = (this->clock_glitch_head_ + 1) % CLOCK_GLITCH_HISTORY_SIZE;
+  ESP_LOGV(TAG, "Clock glitch %u", (unsigned) this->clock_glitches_);
+}
+
+// counts at most CLOCK_GLITCH_HISTORY_SIZE glitches
+uint8_t Tas5805mComponent::clock_faults_per_minute() {
+  uint32_t now = millis();
+  uint8_t recorded = std::min<uint32_t>(this->clock_glitches_, CLOCK_GLITCH_HISTORY_SIZE);
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < recorded; i++) {
+    if ((now - this->clock_glitch_times_[i]) < 60000) count++;
+  }
+  return count;
+}
+
+float Tas5805mComponent::clock_mtbg() {
+  if (this->clock_glitches_ < 2) return 0.0f;
+  uint8_t last = (this->clock_glitch_head_ + CLOCK_GLITCH_HISTORY_SIZE - 1) % CLOCK_GLITCH_HISTORY_SIZE;
+  return (this->clock_glitch_times_[last] - this->first_clock_glitch_) / 1000.0f / (this->clock_glitches_ - 1);
+}
+
+bool Tas5805mComponent::is_clock_monitor_used_() {
+  #ifdef USE_TAS5805M_SENSOR
+  return (this->sample_rate_sensor_ != nullptr) || (this->bck_ratio_sensor_ != nullptr) ||
+         (this->output_latency_sensor_ != nullptr) || this->output_latency_tracked_;
+  #else
+  return this->output_latency_tracked_;
+  #endif
+}
+
+// eq coefficients are big endian 5.27 fixed point
+static float eq_coefficient(const uint8_t* bytes) {
+  int32_t value = (int32_t) (((uint32_t) bytes[0] << 24) | ((uint32_t) bytes[1] << 16) |
+                             ((uint32_t) bytes[2] << 8) | bytes[3]);
+  return value / 134217728.0f;  // 2^27
+}
+
+// group delay in samples at 'w' radians per sample of c0 + c1.z^-1 + c2.z^-2
+static float polynomial_group_delay(float c0, float c1, float c2, float w) {
+  float re = c0 + (c1 * cosf(w)) + (c2 * cosf(2.0f * w));
+  float im = -((c1 * sinf(w)) + (c2 * sinf(2.0f * w)));
+  float k_re = (c1 * cosf(w)) + (2.0f * c2 * cosf(2.0f * w));
+  float k_im = -((c1 * sinf(w)) + (2.0f * c2 * sinf(2.0f * w)));
+  return ((k_re * re) + (k_im * im)) / ((re * re) + (im * im));
+}
+
+// each eq band is a biquad b0, b1, b2, a1, a2 with y = b0.x0 + b1.x1 + b2.x2 + a1.y1 + a2.y2,
+// its group delay at the reference frequency is the delay of its numerator less that of its denominator
+float Tas5805mComponent::eq_group_delay_ms_() {
+  float delay = 0.0f;
+  #ifdef USE_TAS5805M_EQ
+  if (!this->tas5805m_eq_enabled_) return delay;
+  const float w = 2.0f * (float) M_PI * LATENCY_REFERENCE_FREQUENCY / TAS5805M_EQ_SAMPLE_RATE;
+  for (uint8_t band = 0; band < NUMBER_EQ_BANDS; band++) {
+    // a band at 0dB passes audio unchanged
+    if (this->tas5805m_eq_gain_[band] == 0) continue;
+    const uint8_t* value = TAS5805M_EQ_REGISTERS[this->tas5805m_eq_gain_[band] + TAS5805M_EQ_MAX_DB][band].value;
+    float c[5];
+    for (uint8_t i = 0; i < 5; i++) c[i] = eq_coefficient(value + (4 * i));
+    delay += polynomial_group_delay(c[0], c[1], c[2], w) - polynomial_group_delay(1.0f, -c[3], -c[4], w);
+  }
+  #endif
+  return (delay * 1000.0f) / TAS5805M_EQ_SAMPLE_RATE;
+}
+
+// published and passed to callbacks when changed by at least 1us
+void Tas5805mComponent::update_output_latency_() {
+  uint32_t sample_rate = (this->clock_sample_rate_ != 0) ? this->clock_sample_rate_ : VOLUME_RAMP_SAMPLE_RATE;
+  float latency = (this->pipeline_latency_samples_ * 1000.0f) / sample_rate + this->eq_group_delay_ms_();
+  latency = std::max(latency, 0.0f);
+  if (std::fabs(latency - this->output_latency_ms_) < 0.001f) return;
+
+  this->output_latency_ms_ = latency;
+  ESP_LOGV(TAG, "Output latency: %5.3fms", latency);
+  this->output_latency_callback_.call(latency);
+  #ifdef USE_TAS5805M_SENSOR
+  if (this->output_latency_sensor_ != nullptr) this->output_latency_sensor_->publish_state(latency);
+  #endif
+}
+
+// sensors are only published when their value has changed
+void Tas5805mComponent::publish_clock_health_() {
+  #ifdef USE_TAS5805M_SENSOR
+  if ((this->sample_rate_sensor_ != nullptr) &&
+      (!this->sample_rate_sensor_->has_state() || (this->sample_rate_sensor_->state != this->clock_sample_rate_))) {
+    this->sample_rate_sensor_->publish_state(this->clock_sample_rate_);
+  }
+  if ((this->bck_ratio_sensor_ != nullptr) &&
+      (!this->bck_ratio_sensor_->has_state() || (this->bck_ratio_sensor_->state != this->clock_bck_ratio_))) {
+    this->bck_ratio_sensor_->publish_state(this->clock_bck_ratio_);
+  }
+  if (this->clock_faults_per_minute_sensor_ != nullptr) {
+    float per_minute = this->clock_faults_per_minute();
+    if (!this->clock_faults_per_minute_sensor_->has_state() || (this->clock_faults_per_minute_sensor_->state != per_minute)) {
+      this->clock_faults_per_minute_sensor_->publish_state(per_minute);
+    }
+  }
+  if ((this->clock_mtbg_sensor_ != nullptr) && (this->clock_glitches_ >= 2)) {
+    float mtbg = this->clock_mtbg();
+    if (!this->clock_mtbg_sensor_->has_state() || (this->clock_mtbg_sensor_->state != mtbg)) {
+      this->clock_mtbg_sensor_->publish_state(mtbg);
+    }
+  }
+  #endif
+}
+
+// every 'thermal_foldback_interval_' attenuation is increased by a step while the over temperature warning
+// persists, and is reduced by a step once the warning has been clear for 'thermal_foldback_hold_'
+// the warning bit is from the last fault poll, which may be longer ago than 'thermal_foldback_interval_'
+void Tas5805mComponent::thermal_foldback_step_() {
+  float foldback_db = this->thermal_foldback_db_;
+  bool warning = this->tas5805m_faults_.temperature_warning;
+
+  if (warning) {
+    foldback_db = std::min(foldback_db + this->thermal_foldback_step_db_, this->thermal_foldback_max_db_);
+  } else if ((millis() - this->last_thermal_warning_) >= this->thermal_foldback_hold_) {
+    foldback_db = std::max(foldback_db - this->thermal_foldback_step_db_, 0.0f);
+  }
+
+  if (foldback_db != this->thermal_foldback_db_) {
+    this->thermal_foldback_db_ = foldback_db;
+    ESP_LOGW(TAG, "Thermal foldback: %3.1fdB", foldback_db);
+    this->set_interval("thermal_ramp", DUCK_STEP_INTERVAL, [this]() { this->thermal_gain_ramp_step_(); });
+    #ifdef USE_TAS5805M_SENSOR
+    if (this->thermal_foldback_sensor_ != nullptr) this->thermal_foldback_sensor_->publish_state(foldback_db);
+    #endif
+  }
+
+  if (!warning && (foldback_db == 0.0f)) {
+    this->thermal_foldback_running_ = false;
+    this->cancel_interval("thermal_foldback");
+  }
+}
+
+// thermal gain is ramped in small steps since a foldback step is several dB
+void Tas5805mComponent::thermal_gain_ramp_step_() {
+  float target_db = -this->thermal_foldback_db_;
+  if (this->thermal_gain_db_ > target_db) {
+    this->thermal_gain_db_ = std::max(this->thermal_gain_db_ - THERMAL_RAMP_STEP_DB, target_db);
+  } else {
+    this->thermal_gain_db_ = std::min(this->thermal_gain_db_ + THERMAL_RAMP_STEP_DB, target_db);
+  }
+
+  // dsp volume words are written with mixer by 'loop' if refresh of settings has not happened yet
+  if (this->mixer_mode_configured_ && !this->write_channel_volume_()) {
+    ESP_LOGW(TAG, "%sthermal foldback", ERROR);
+  }
+
+  if (this->thermal_gain_db_ == target_db) this->cancel_interval("thermal_ramp");
+}
+
+// ramps duck gain to 'target_db' in steps of DUCK_STEP_INTERVAL
+void Tas5805mComponent::start_duck_ramp_(float target_db, uint32_t ramp_time) {
+  this->duck_ramp_from_db_ = this->duck_gain_db_;
+  this->duck_ramp_to_db_ = target_db;
+  this->duck_ramp_steps_ = std::max<uint32_t>(1, ramp_time / DUCK_STEP_INTERVAL);
+  this->duck_ramp_index_ = 0;
+  if (ramp_time < DUCK_STEP_INTERVAL) {
+    this->cancel_interval("duck");
+    this->duck_ramp_step_();
+    return;
+  }
+  this->set_interval("duck", ramp_time / this->duck_ramp_steps_, [this]() { this->duck_ramp_step_(); });
+}
+
+void Tas5805mComponent::duck_ramp_step_() {
+  this->duck_ramp_index_++;
+  this->duck_gain_db_ = this->duck_ramp_from_db_ +
+      (this->duck_ramp_to_db_ - this->duck_ramp_from_db_) * this->duck_ramp_index_ / this->duck_ramp_steps_;
+
+  // dsp volume words are written with mixer by 'loop' if refresh of settings has not happened yet
+  if (this->mixer_mode_configured_ && !this->write_channel_volume_()) {
+    ESP_LOGW(TAG, "%sducking", ERROR);
+  }
+
+  if (this->duck_ramp_index_ < this->duck_ramp_steps_) return;
+  this->cancel_interval("duck");
+
+  if (this->duck_phase_ == DUCK_ATTACK) {
+    this->duck_phase_ = DUCK_HOLD;
+    this->check_duck_release_();
+  } else if (this->duck_phase_ == DUCK_RELEASE) {
+    // exactly 0dB so channel volumes are restored exactly
+    this->duck_gain_db_ = 0.0f;
+    this->duck_level_db_ = 0.0f;
+    this->duck_phase_ = DUCK_IDLE;
+    ESP_LOGD(TAG, "Duck released");
+  }
+}
+
+// releases once all ducks have ended
+void Tas5805mComponent::check_duck_release_() {
+  if (this->duck_phase_ != DUCK_HOLD) return;
+  if (this->duck_holds_ > 0) return;
+  if ((int32_t)(millis() - this->duck_hold_until_) < 0) return;
+  this->duck_phase_ = DUCK_RELEASE;
+  this->start_duck_ramp_(0.0f, this->duck_release_);
+}
+
 #ifdef USE_TAS5805M_EQ
 bool Tas5805mComponent::get_eq_(bool* enabled) {
   uint8_t current_value;
@@ -600,6 +1697,7 @@ bool Tas5805mComponent::set_eq_off_() {
   if (!this->tas5805m_eq_enabled_) return true;
   if (!this->tas5805m_write_byte_(TAS5805M_DSP_MISC, TAS5805M_CTRL_EQ_OFF)) return false;
   this->tas5805m_eq_enabled_ = false;
+  this->update_output_latency_();
   ESP_LOGV(TAG, "EQ control Off");
   #endif
   return true;
@@ -610,84 +1708,255 @@ bool Tas5805mComponent::set_eq_on_() {
   if (this->tas5805m_eq_enabled_) return true;
   if (!this->tas5805m_write_byte_(TAS5805M_DSP_MISC, TAS5805M_CTRL_EQ_ON)) return false;
   this->tas5805m_eq_enabled_ = true;
+  this->update_output_latency_();
   ESP_LOGV(TAG, "EQ control On");
   #endif
   return true;
 }
 
+// level meter words are 1.31 format, converted to dBFS
+static float level_meter_to_db(const uint8_t* raw) {
+  uint32_t level = encode_uint32(raw[0], raw[1], raw[2], raw[3]);
+  if (level == 0) return TAS5805M_LEVEL_METER_FLOOR_DB;
+  float level_db = 20.0f * log10f(static_cast<float>(level) / LEVEL_METER_FULL_SCALE);
+  return std::max(level_db, TAS5805M_LEVEL_METER_FLOOR_DB);
+}
+
+// reads left and right level meter words in one burst
+bool Tas5805mComponent::read_level_meter_(float* left_db, float* right_db) {
+  uint8_t raw_levels[8];
+
+  if (!this->set_book_and_page_(TAS5805M_REG_BOOK_LEVEL_METER, TAS5805M_REG_LEVEL_METER_PAGE)) return false;
+
+  bool read_ok = this->tas5805m_read_bytes_(TAS5805M_REG_LEFT_LEVEL_METER, raw_levels, 8);
+
+  // always return to control port book even if read failed
+  if (!this->set_book_and_page_(TAS5805M_REG_BOOK_CONTROL_PORT, TAS5805M_REG_PAGE_ZERO)) return false;
+  if (!read_ok) return false;
+
+  *left_db = level_meter_to_db(raw_levels);
+  *right_db = level_meter_to_db(raw_levels + (TAS5805M_REG_RIGHT_LEVEL_METER - TAS5805M_REG_LEFT_LEVEL_METER));
+  return true;
+}
+
+// moves through the idle power tiers and wakes again, runs from 'update' at the update interval
+void Tas5805mComponent::update_power_management_() {
+  if ((this->idle_hi_z_timeout_ == 0) && (this->idle_deep_sleep_timeout_ == 0)) return;
+  if (this->is_sequence_running() || (this->recovery_state_ != RECOVERY_IDLE)) return;
+
+  uint8_t fs_mon;
+  if (!this->tas5805m_read_byte_(TAS5805M_FS_MON, &fs_mon)) {
+    ESP_LOGW(TAG, "%sreading clock monitor", ERROR);
+    return;
+  }
+  bool clock_present = ((fs_mon & TAS5805M_FS_MON_FS_MASK) != 0);
+  bool clock_returned = clock_present && !this->clock_present_;
+  this->clock_present_ = clock_present;
+
+  uint32_t idle_time = millis() - this->last_activity_;
+
+  switch (this->power_tier_) {
+    case POWER_TIER_NONE:
+      // only manage power from play, other control states were explicitly requested
+      if ((this->tas5805m_control_state_ != CTRL_PLAY) || (clock_present && this->is_audio_above_idle_level_())) {
+        this->last_activity_ = millis();
+        return;
+      }
+      if ((this->idle_hi_z_timeout_ != 0) && (idle_time >= this->idle_hi_z_timeout_)) {
+        this->enter_power_tier_(POWER_TIER_HI_Z);
+        return;
+      }
+      // without a Hi-Z tier go straight to deep sleep
+      if ((this->idle_hi_z_timeout_ == 0) && !clock_present && (idle_time >= this->idle_deep_sleep_timeout_)) {
+        this->enter_power_tier_(POWER_TIER_DEEP_SLEEP);
+      }
+      return;
+
+    case POWER_TIER_HI_Z:
+      if (clock_returned || (clock_present && this->is_audio_above_idle_level_())) {
+        this->wake();
+        return;
+      }
+      // deep sleep stops the dsp so only entered once clock has stopped
+      // then a returning clock can be detected to wake
+      if ((this->idle_deep_sleep_timeout_ != 0) && !clock_present && (idle_time >= this->idle_deep_sleep_timeout_)) {
+        this->enter_power_tier_(POWER_TIER_DEEP_SLEEP);
+      }
+      return;
+
+    case POWER_TIER_DEEP_SLEEP:
+      if (clock_returned) this->wake();
+      return;
+  }
+}
+
+// uses latest shared level meter reading if recent, otherwise reads level meter
+bool Tas5805mComponent::is_audio_above_idle_level_() {
+  if (this->tas5805m_control_state_ < CTRL_HI_Z) return false;
+
+  float left_db, right_db;
+  Tas5805mLevel level;
+  if (this->get_latest_level(&level) && ((millis() - level.timestamp) < this->get_update_interval())) {
+    left_db = level.left;
+    right_db = level.right;
+  } else if (!this->read_level_meter_(&left_db, &right_db)) {
+    ESP_LOGW(TAG, "%sreading level meter", ERROR);
+    return true;  // stay awake when level is unknown
+  }
+  return (left_db > this->idle_level_threshold_db_) || (right_db > this->idle_level_threshold_db_);
+}
+
+void Tas5805mComponent::enter_power_tier_(PowerTier tier) {
+  ESP_LOGD(TAG, "Idle for %us, entering %s", (millis() - this->last_activity_) / 1000, POWER_TIER_TEXT[tier]);
+  this->power_tier_ = tier;
+  this->start_sequence_((tier == POWER_TIER_HI_Z) ? CTRL_HI_Z : CTRL_DEEP_SLEEP, this->is_muted_);
+}
+
+// (re)starts level meter polling at the fastest rate any consumer needs
+// level sensors only need 'level_publish_interval' while callbacks need 'level_meter_interval'
+void Tas5805mComponent::start_level_meter_() {
+  uint32_t interval = 0;
+  if (this->level_meter_callback_.size() > 0) {
+    interval = this->level_meter_interval_;
+  }
+
+  #ifdef USE_TAS5805M_SENSOR
+  if ((this->left_channel_level_sensor_ != nullptr) || (this->right_channel_level_sensor_ != nullptr)) {
+    if ((interval == 0) || (this->level_publish_interval_ < interval)) {
+      interval = this->level_publish_interval_;
+    }
+  }
+  // level sensors are published every n level meter reads
+  this->level_reads_per_publish_ = (interval == 0) ? 1 : std::max<uint32_t>(1, this->level_publish_interval_ / interval);
+  #endif
+
+  // no consumers of level meter readings
+  if (interval == 0) return;
+
+  this->set_interval("level_meter", interval, [this]() { this->update_level_meter_(); });
+}
+
+void Tas5805mComponent::update_level_meter_() {
+  // level meter is only meaningful once i2s clock is expected and tas5805m is playing
+  if (!this->update_delay_finished_ || (this->tas5805m_control_state_ != CTRL_PLAY)) return;
+
+  float left_db, right_db;
+  if (!this->read_level_meter_(&left_db, &right_db)) {
+    ESP_LOGW(TAG, "%sreading level meter", ERROR);
+    return;
+  }
+
+  Tas5805mLevel* level = &this->level_history_[this->level_history_head_];
+  level->timestamp = millis();
+  level->left = left_db;
+  level->right = right_db;
+  this->level_history_head_ = (this->level_history_head_ + 1) % LEVEL_METER_HISTORY_SIZE;
+  if (this->level_history_count_ < LEVEL_METER_HISTORY_SIZE) this->level_history_count_++;
+
+  this->level_meter_callback_.call(left_db, right_db);
+
+  #ifdef USE_TAS5805M_SENSOR
+  this->level_read_counter_++;
+  if (this->level_read_counter_ >= this->level_reads_per_publish_) {
+    this->level_read_counter_ = 0;
+    this->publish_levels_();
+  }
+  #endif
+}
+
+#ifdef USE_TAS5805M_SENSOR
+// only publish a level sensor when it has moved more than its hysteresis
+void Tas5805mComponent::publish_levels_() {
+  Tas5805mLevel level;
+  if (!this->get_latest_level(&level)) return;
+
+  float new_levels[2] = {level.left, level.right};
+  sensor::Sensor* level_sensors[2] = {this->left_channel_level_sensor_, this->right_channel_level_sensor_};
+
+  for (uint8_t channel = 0; channel < 2; channel++) {
+    if (level_sensors[channel] == nullptr) continue;
+    if (!std::isnan(this->last_published_level_[channel]) &&
+        (std::fabs(new_levels[channel] - this->last_published_level_[channel]) < this->level_hysteresis_[channel])) continue;
+    level_sensors[channel]->publish_state(new_levels[channel]);
+    this->last_published_level_[channel] = new_levels[channel];
+  }
+}
+#endif
+
 bool Tas5805mComponent::get_mixer_mode_(MixerMode *mode) {
   *mode = this->tas5805m_mixer_mode_;
   return true;
 }
 
-// only runs once from 'loop'
-// 'mixer_mode_configured_' used by 'loop' to ensure only runs once
-bool Tas5805mComponent::set_mixer_mode_(MixerMode mode) {
-  uint32_t mixer_l_to_l, mixer_r_to_r, mixer_l_to_r, mixer_r_to_l;
+// sets mixer matrix gains for a mixer mode preset
+void Tas5805mComponent::mixer_mode_gains_(MixerMode mode) {
+  float l_to_l = TAS5805M_MIN_MIXER_GAIN_DB;
+  float r_to_l = TAS5805M_MIN_MIXER_GAIN_DB;
+  float l_to_r = TAS5805M_MIN_MIXER_GAIN_DB;
+  float r_to_r = TAS5805M_MIN_MIXER_GAIN_DB;
 
   switch (mode) {
     case STEREO:
-      mixer_l_to_l = TAS5805M_MIXER_VALUE_0DB;
-      mixer_r_to_r = TAS5805M_MIXER_VALUE_0DB;
-      mixer_l_to_r = TAS5805M_MIXER_VALUE_MUTE;
-      mixer_r_to_l = TAS5805M_MIXER_VALUE_MUTE;
+      l_to_l = 0.0;
+      r_to_r = 0.0;
       break;
 
     case STEREO_INVERSE:
-      mixer_l_to_l = TAS5805M_MIXER_VALUE_MUTE;
-      mixer_r_to_r = TAS5805M_MIXER_VALUE_MUTE;
-      mixer_l_to_r = TAS5805M_MIXER_VALUE_0DB;
-      mixer_r_to_l = TAS5805M_MIXER_VALUE_0DB;
+      l_to_r = 0.0;
+      r_to_l = 0.0;
       break;
 
     case MONO:
-      mixer_l_to_l = TAS5805M_MIXER_VALUE_MINUS6DB;
-      mixer_r_to_r = TAS5805M_MIXER_VALUE_MINUS6DB;
-      mixer_l_to_r = TAS5805M_MIXER_VALUE_MINUS6DB;
-      mixer_r_to_l = TAS5805M_MIXER_VALUE_MINUS6DB;
+      l_to_l = -6.0;
+      r_to_l = -6.0;
+      l_to_r = -6.0;
+      r_to_r = -6.0;
       break;
 
     case LEFT:
-      mixer_l_to_l = TAS5805M_MIXER_VALUE_0DB;
-      mixer_r_to_r = TAS5805M_MIXER_VALUE_MUTE;
-      mixer_l_to_r = TAS5805M_MIXER_VALUE_0DB;
-      mixer_r_to_l = TAS5805M_MIXER_VALUE_MUTE;
+      l_to_l = 0.0;
+      l_to_r = 0.0;
       break;
 
     case RIGHT:
-      mixer_l_to_l = TAS5805M_MIXER_VALUE_MUTE;
-      mixer_r_to_r = TAS5805M_MIXER_VALUE_0DB;
-      mixer_l_to_r = TAS5805M_MIXER_VALUE_MUTE;
-      mixer_r_to_l = TAS5805M_MIXER_VALUE_0DB;
+      r_to_l = 0.0;
+      r_to_r = 0.0;
       break;
-
-    default:
-      ESP_LOGW(TAG, "Invalid %s", MIXER_MODE);
-      return false;
   }
 
-  if(!this->set_book_and_page_(TAS5805M_REG_BOOK_5, TAS5805M_REG_BOOK_5_MIXER_PAGE)) {
-    ESP_LOGE(TAG, "%s begin Set %s", ERROR, MIXER_MODE);
-    return false;
-  }
+  this->mixer_gain_db_[MIXER_LEFT_TO_LEFT] = l_to_l;
+  this->mixer_gain_db_[MIXER_RIGHT_TO_LEFT] = r_to_l;
+  this->mixer_gain_db_[MIXER_LEFT_TO_RIGHT] = l_to_r;
+  this->mixer_gain_db_[MIXER_RIGHT_TO_RIGHT] = r_to_r;
+  for (uint8_t path = 0; path < 4; path++) this->mixer_invert_[path] = false;
+}
 
-  if (!this->tas5805m_write_bytes_(TAS5805M_REG_LEFT_TO_LEFT_GAIN, reinterpret_cast<uint8_t *>(&mixer_l_to_l), 4)) {
-    ESP_LOGE(TAG, "%s Mixer L-L Gain", ERROR);
-    return false;
+float Tas5805mComponent::mixer_target_gain_(uint8_t path) {
+  if (this->mixer_gain_db_[path] <= TAS5805M_MIN_MIXER_GAIN_DB) return 0.0f;
+  float gain = powf(10.0f, this->mixer_gain_db_[path] / 20.0f);
+  return this->mixer_invert_[path] ? -gain : gain;
+}
+
+// all four mixer gains are written in one 16 byte burst
+bool Tas5805mComponent::write_mixer_gains_(const float* gains) {
+  if (!this->is_dsp_retained_()) {
+    for (uint8_t path = 0; path < 4; path++) this->mixer_written_gain_[path] = gains[path];
+    this->mark_dsp_lost_(DSP_BLOCK_MIXER);
+    return true;
   }
 
-  if (!this->tas5805m_write_bytes_(TAS5805M_REG_RIGHT_TO_RIGHT_GAIN, reinterpret_cast<uint8_t *>(&mixer_r_to_r), 4)) {
-    ESP_LOGE(TAG, "%s Mixer R-R Gain", ERROR);
-    return false;
+  uint8_t mixer_words[16];
+  for (uint8_t path = 0; path < 4; path++) {
+    gain_to_9_23(gains[path], mixer_words + (path * 4));
   }
 
-  if (!this->tas5805m_write_bytes_(TAS5805M_REG_LEFT_TO_RIGHT_GAIN, reinterpret_cast<uint8_t *>(&mixer_l_to_r), 4)) {
-    ESP_LOGE(TAG, "%s Mixer L-R Gain", ERROR);
+  if(!this->set_book_and_page_(TAS5805M_REG_BOOK_5, TAS5805M_REG_BOOK_5_MIXER_PAGE)) {
+    ESP_LOGE(TAG, "%s begin Set %s", ERROR, MIXER_MODE);
     return false;
   }
 
-  if (!this->tas5805m_write_bytes_(TAS5805M_REG_RIGHT_TO_LEFT_GAIN, reinterpret_cast<uint8_t *>(&mixer_r_to_l), 4)) {
-    ESP_LOGE(TAG, "%s Mixer R-L Gain", ERROR);
+  if (!this->tas5805m_write_bytes_(TAS5805M_REG_LEFT_TO_LEFT_GAIN, mixer_words, 16)) {
+    ESP_LOGE(TAG, "%s Mixer Gains", ERROR);
     return false;
   }
 
@@ -696,37 +1965,293 @@ bool Tas5805mComponent::set_mixer_mode_(MixerMode mode) {
     return false;
   }
 
-  // 'tas5805m_state_' global already has mixer mode from YAML config
-  // save anyway so 'set_mixer_mode' could be used more generally in future
-  this->tas5805m_mixer_mode_ = mode;
-  ESP_LOGD(TAG, "%s: %s", MIXER_MODE, MIXER_MODE_TEXT[this->tas5805m_mixer_mode_]);
+  for (uint8_t path = 0; path < 4; path++) this->mixer_written_gain_[path] = gains[path];
   return true;
 }
 
+// mixer changes are ramped linearly from the gains last written so a phase
+// inversion passes through zero rather than stepping
+void Tas5805mComponent::start_mixer_ramp_() {
+  // written by 'loop' if refresh of settings has not happened yet
+  if (!this->mixer_mode_configured_) return;
+
+  for (uint8_t path = 0; path < 4; path++) this->mixer_ramp_from_gain_[path] = this->mixer_written_gain_[path];
+  this->mixer_ramp_index_ = 0;
+  this->set_interval("mixer", MIXER_STEP_INTERVAL, [this]() { this->mixer_ramp_step_(); });
+}
+
+void Tas5805mComponent::mixer_ramp_step_() {
+  this->mixer_ramp_index_++;
+  float gains[4];
+  for (uint8_t path = 0; path < 4; path++) {
+    gains[path] = this->mixer_ramp_from_gain_[path] +
+        (this->mixer_target_gain_(path) - this->mixer_ramp_from_gain_[path]) * this->mixer_ramp_index_ / MIXER_RAMP_STEPS;
+  }
+
+  if (!this->write_mixer_gains_(gains)) {
+    ESP_LOGW(TAG, "%ssetting %s", ERROR, MIXER_MODE);
+    this->cancel_interval("mixer");
+    return;
+  }
+  if (this->mixer_ramp_index_ >= MIXER_RAMP_STEPS) this->cancel_interval("mixer");
+}
+
+// control state reported by POWER_STATE at last fault poll
 bool Tas5805mComponent::get_state_(ControlState* state) {
-  *state = this->tas5805m_control_state_;
-  return true;
+  *state = this->tas5805m_power_state_;
+  return this->power_state_read_;
 }
 
+// immediate change of control state, used during setup
 bool Tas5805mComponent::set_state_(ControlState state) {
   if (this->tas5805m_control_state_ == state) return true;
-  if (!this->tas5805m_write_byte_(TAS5805M_DEVICE_CTRL_2, state)) return false;
+  return this->write_device_ctrl_2_(state, this->tas5805m_device_muted_);
+}
+
+bool Tas5805mComponent::write_device_ctrl_2_(ControlState state, bool mute) {
+  uint8_t new_value = mute ? (state + TAS5805M_MUTE_CONTROL) : state;
+  if (!this->tas5805m_write_byte_(TAS5805M_DEVICE_CTRL_2, new_value)) return false;
+
+  // everything already written to the dsp is lost in deep sleep
+  if ((state == CTRL_DEEP_SLEEP) && this->is_dsp_retained_()) {
+    if (this->mixer_mode_configured_) this->mark_dsp_lost_(DSP_BLOCK_MIXER | DSP_BLOCK_VOLUME);
+    #ifdef USE_TAS5805M_EQ
+    if (this->refresh_settings_triggered_ && this->using_eq_gains_) {
+      this->eq_bands_lost_ = (1 << NUMBER_EQ_BANDS) - 1;
+      this->mark_dsp_lost_(DSP_BLOCK_EQ);
+    }
+    #endif
+  }
   this->tas5805m_control_state_ = state;
+  this->tas5805m_device_muted_ = mute;
   return true;
 }
 
+void Tas5805mComponent::mark_dsp_lost_(uint8_t blocks) {
+  this->dsp_blocks_lost_ |= blocks;
+}
+
+// replays only the lost dsp blocks from shadow state in one pass, grouped by book and page
+// so each book is selected once and pages only change when needed
+bool Tas5805mComponent::replay_dsp_state_() {
+  uint32_t start = micros();
+  uint8_t blocks = this->dsp_blocks_lost_;
+
+  if (blocks & (DSP_BLOCK_MIXER | DSP_BLOCK_VOLUME)) {
+    uint8_t page = (blocks & DSP_BLOCK_MIXER) ? TAS5805M_REG_BOOK_5_MIXER_PAGE : TAS5805M_REG_BOOK_5_VOLUME_PAGE;
+    if (!this->set_book_and_page_(TAS5805M_REG_BOOK_5, page)) return false;
+
+    if (blocks & DSP_BLOCK_MIXER) {
+      uint8_t mixer_words[16];
+      for (uint8_t path = 0; path < 4; path++) {
+        gain_to_9_23(this->mixer_written_gain_[path], mixer_words + (path * 4));
+      }
+      if (!this->tas5805m_write_bytes_(TAS5805M_REG_LEFT_TO_LEFT_GAIN, mixer_words, 16)) return false;
+    }
+
+    if (blocks & DSP_BLOCK_VOLUME) {
+      if ((page != TAS5805M_REG_BOOK_5_VOLUME_PAGE) &&
+          !this->tas5805m_write_byte_(TAS5805M_REG_PAGE_SET, TAS5805M_REG_BOOK_5_VOLUME_PAGE)) return false;
+      uint8_t volume_words[8];
+      this->channel_volume_words_(volume_words);
+      if (!this->tas5805m_write_bytes_(TAS5805M_REG_LEFT_VOLUME, volume_words, 8)) return false;
+    }
+  }
+
+  #ifdef USE_TAS5805M_EQ
+  if ((blocks & DSP_BLOCK_EQ) && (this->eq_bands_lost_ != 0)) {
+    // eq bands are in ascending page order
+    uint8_t current_page = 0;
+    if (!this->set_book_and_page_(TAS5805M_REG_BOOK_EQ, current_page)) return false;
+    for (uint8_t band = 0; band < NUMBER_EQ_BANDS; band++) {
+      if (!(this->eq_bands_lost_ & (1 << band))) continue;
+      if (!this->write_eq_band_(band, this->tas5805m_eq_gain_[band], &current_page)) return false;
+    }
+  }
+  this->eq_bands_lost_ = 0;
+  #endif
+
+  if (!this->set_book_and_page_(TAS5805M_REG_BOOK_CONTROL_PORT, TAS5805M_REG_PAGE_ZERO)) return false;
+
+  this->dsp_blocks_lost_ = 0;
+  ESP_LOGD(TAG, "DSP state replayed (blocks 0x%02X) in %uus", blocks, (uint32_t) (micros() - start));
+  return true;
+}
+
+// control state requested, which is the sequence target while a sequence is running
+ControlState Tas5805mComponent::target_control_state_() {
+  return this->is_sequence_running() ? this->sequence_target_state_ : this->tas5805m_control_state_;
+}
+
+bool Tas5805mComponent::start_sequence_(ControlState target_state, bool target_mute) {
+  if (!this->is_sequence_running()) {
+    if ((this->tas5805m_control_state_ == target_state) && (this->tas5805m_device_muted_ == target_mute) &&
+        !this->reconfigure_pending_ && !this->power_state_restore_pending_) return true;
+
+    // volume restored at end of sequence, a fade in progress is completed at its target
+    // a volume left muted by a failed sequence is not restored, the earlier volume is kept
+    if (this->fade_steps_ != 0) {
+      this->sequence_restore_raw_volume_ = this->fade_target_raw_;
+    } else if (this->tas5805m_raw_volume_ != TAS5805M_DIGITAL_VOLUME_MUTE) {
+      this->sequence_restore_raw_volume_ = this->tas5805m_raw_volume_;
+    }
+    this->cancel_fade_();
+  } else {
+    // new command mid sequence restarts sequence from current tas5805m state
+    this->cancel_timeout("sequence");
+    ESP_LOGV(TAG, "Sequence restarted");
+  }
+
+  this->sequence_target_state_ = target_state;
+  this->sequence_target_mute_ = target_mute;
+  this->sequence_step_ = SEQUENCE_RAMP_DOWN;
+  this->run_sequence_();
+  return true;
+}
+
+// runs sequence steps until a step needs to wait, then continues from scheduler
+void Tas5805mComponent::run_sequence_() {
+  uint32_t wait = 0;
+  while (this->is_sequence_running()) {
+    if (!this->next_sequence_step_(&wait)) {
+      ESP_LOGW(TAG, "%sin mute/control state sequence", ERROR);
+      this->sequence_step_ = SEQUENCE_IDLE;
+      this->wake_tier_ = POWER_TIER_NONE;
+      return;
+    }
+    if (wait != 0) {
+      this->set_timeout("sequence", wait, [this]() { this->run_sequence_(); });
+      return;
+    }
+  }
+  this->sequence_complete_();
+}
+
+// wake latency is from wake command or detected clock until playing at restored volume
+void Tas5805mComponent::sequence_complete_() {
+  // control state or mute has changed so check faults now
+  this->request_fault_check();
+
+  if (this->wake_tier_ == POWER_TIER_NONE) return;
+  PowerTier tier = this->wake_tier_;
+  this->wake_tier_ = POWER_TIER_NONE;
+  if (this->tas5805m_control_state_ != CTRL_PLAY) return;
+
+  float latency = (micros() - this->wake_start_us_) / 1000.0f;
+  ESP_LOGD(TAG, "Wake from %s: %3.1fms", POWER_TIER_TEXT[tier], latency);
+  #ifdef USE_TAS5805M_SENSOR
+  sensor::Sensor* latency_sensor = (tier == POWER_TIER_HI_Z) ? this->hi_z_wake_latency_sensor_
+                                                             : this->deep_sleep_wake_latency_sensor_;
+  if (latency_sensor != nullptr) latency_sensor->publish_state(latency);
+  #endif
+}
+
+bool Tas5805mComponent::next_sequence_step_(uint32_t* wait) {
+  *wait = 0;
+  switch (this->sequence_step_) {
+    case SEQUENCE_RAMP_DOWN: {
+      this->sequence_step_ = SEQUENCE_MUTE;
+      if (this->tas5805m_raw_volume_ == TAS5805M_DIGITAL_VOLUME_MUTE) return true;
+
+      // digital volume is ramped down even if already muted so it is
+      // at zero before any unmute and can be ramped back up
+      // no need to wait for the ramp when output is not audible, which shortens wake from idle
+      uint8_t rate = (this->tas5805m_current_volume_ramp_ >> 6) & 0x03;
+      uint8_t step = (this->tas5805m_current_volume_ramp_ >> 4) & 0x03;
+      bool audible = (this->tas5805m_control_state_ == CTRL_PLAY) && !this->tas5805m_device_muted_;
+      if (audible && (rate != RAMP_RATE_INSTANT)) {
+        *wait = volume_ramp_time_us(TAS5805M_DIGITAL_VOLUME_MUTE - this->tas5805m_raw_volume_, rate, step) / 1000 + 1;
+      }
+      return this->set_digital_volume_(TAS5805M_DIGITAL_VOLUME_MUTE);
+    }
+
+    case SEQUENCE_MUTE:
+      this->sequence_step_ = SEQUENCE_RECONFIGURE;
+      if (this->tas5805m_device_muted_) return true;
+      return this->write_device_ctrl_2_(this->tas5805m_control_state_, true);
+
+    case SEQUENCE_RECONFIGURE:
+      if (!this->reconfigure_pending_) {
+        this->sequence_step_ = SEQUENCE_CHANGE_STATE;
+        return true;
+      }
+      // output stage must not be switching when dac mode, modulation or analog gain change
+      // remains in this step until in Hi-Z then change state step returns to target state
+      if (this->tas5805m_control_state_ == CTRL_PLAY) {
+        *wait = STATE_SETTLE_TIME;
+        ESP_LOGV(TAG, "Control State: %d", CTRL_HI_Z);
+        return this->write_device_ctrl_2_(CTRL_HI_Z, true);
+      }
+      this->reconfigure_pending_ = false;
+      this->sequence_step_ = SEQUENCE_CHANGE_STATE;
+      if ((this->target_dac_mode_ != this->tas5805m_dac_mode_) ||
+          (this->target_switching_frequency_ != this->tas5805m_switching_frequency_) ||
+          (this->target_modulation_mode_ != this->tas5805m_modulation_mode_)) {
+        if (!this->write_device_ctrl_1_(this->target_switching_frequency_, this->target_dac_mode_,
+                                        this->target_modulation_mode_)) return false;
+      }
+      if (this->target_analog_gain_ != this->tas5805m_analog_gain_) return this->set_analog_gain_(this->target_analog_gain_);
+      return true;
+
+    case SEQUENCE_CHANGE_STATE: {
+      // once out of deep sleep the dsp is running so lost state is replayed before unmuting
+      if ((this->dsp_blocks_lost_ != 0) && (this->tas5805m_control_state_ >= CTRL_HI_Z)) {
+        return this->replay_dsp_state_();
+      }
+      if ((this->tas5805m_control_state_ == this->sequence_target_state_) && !this->power_state_restore_pending_) {
+        this->sequence_step_ = SEQUENCE_UNMUTE;
+        return true;
+      }
+      // after a fault shutdown the target state is written again from the state the tas5805m reported
+      ControlState from_state = this->tas5805m_control_state_;
+      if (this->power_state_restore_pending_) {
+        from_state = this->tas5805m_power_state_;
+        this->power_state_restore_pending_ = false;
+      }
+      // leaving sleep or deep sleep for play goes through Hi-Z first
+      // remains in this step until target state is reached
+      ControlState next_state = this->sequence_target_state_;
+      if ((next_state == CTRL_PLAY) && (from_state < CTRL_HI_Z)) {
+        next_state = CTRL_HI_Z;
+        *wait = STATE_SETTLE_TIME;
+      }
+      ESP_LOGV(TAG, "Control State: %d", next_state);
+      return this->write_device_ctrl_2_(next_state, true);
+    }
+
+    case SEQUENCE_UNMUTE:
+      this->sequence_step_ = SEQUENCE_RAMP_UP;
+      if (this->sequence_target_mute_) return true;
+      return this->write_device_ctrl_2_(this->tas5805m_control_state_, false);
+
+    case SEQUENCE_RAMP_UP:
+      // when muted or not playing volume is restored silently
+      this->sequence_step_ = SEQUENCE_IDLE;
+      return this->set_digital_volume_(this->sequence_restore_raw_volume_);
+
+    default:
+      this->sequence_step_ = SEQUENCE_IDLE;
+      return true;
+  }
+}
+
 bool Tas5805mComponent::clear_fault_registers_() {
   if (!this->tas5805m_write_byte_(TAS5805M_FAULT_CLEAR, TAS5805M_ANALOG_FAULT_CLEAR)) return false;
   this->times_faults_cleared_++;
+  Tas5805mFaultEvent* active = this->active_fault_event_();
+  if (active != nullptr) active->cleared = true;
   ESP_LOGD(TAG, "Faults cleared");
   return true;
 }
 
 bool Tas5805mComponent::read_fault_registers_() {
-  uint8_t current_faults[4];
+  uint8_t status[TAS5805M_STATUS_READ_BYTES];
+
+  // read power state and all faults registers in one burst
+  if (!this->tas5805m_read_bytes_(TAS5805M_POWER_STATE, status, TAS5805M_STATUS_READ_BYTES)) return false;
+  uint8_t* current_faults = status + (TAS5805M_CHAN_FAULT - TAS5805M_POWER_STATE);
 
-  // read all faults registers
-  if (!this->tas5805m_read_bytes_(TAS5805M_CHAN_FAULT, current_faults, 4)) return false;
+  this->record_fault_event_(current_faults);
 
   // note: new state is saved regardless as it is not worth conditionally saving state based on whether state has changed
 
@@ -766,9 +2291,95 @@ bool Tas5805mComponent::read_fault_registers_() {
   this->tas5805m_faults_.have_fault = new_fault_state;
   #endif
 
+  this->reconcile_power_state_((ControlState) (status[0] & TAS5805M_POWER_STATE_MASK));
   return true;
 }
 
+// a shutdown fault leaves the tas5805m in a lower state than the requested control state, which
+// is kept and written again by the pop free sequence once the fault has cleared
+// the over temperature warning does not shut down the tas5805m
+// other differences, such as play without an i2s clock, are only reported
+void Tas5805mComponent::reconcile_power_state_(ControlState power_state) {
+  bool changed = !this->power_state_read_ || (power_state != this->tas5805m_power_state_);
+  this->tas5805m_power_state_ = power_state;
+  this->power_state_read_ = true;
+
+  bool shutdown_fault = (this->tas5805m_faults_.channel_fault || this->tas5805m_faults_.global_fault ||
+                         this->tas5805m_faults_.temperature_fault);
+  if (this->is_sequence_running() || (power_state >= this->tas5805m_control_state_)) {
+    if (!shutdown_fault) this->fault_shutdown_ = false;
+  } else if (shutdown_fault) {
+    if (!this->fault_shutdown_) {
+      ESP_LOGW(TAG, "Power state %s after fault, expected %s", CONTROL_STATE_TEXT[power_state],
+               CONTROL_STATE_TEXT[this->tas5805m_control_state_]);
+    }
+    this->fault_shutdown_ = true;
+  } else if (this->fault_shutdown_) {
+    ESP_LOGI(TAG, "Fault cleared, restoring %s", CONTROL_STATE_TEXT[this->tas5805m_control_state_]);
+    this->fault_shutdown_ = false;
+    this->power_state_restore_pending_ = true;
+    this->start_sequence_(this->tas5805m_control_state_, this->is_muted_);
+  }
+
+  if (!changed) return;
+  ESP_LOGD(TAG, "Power state: %s", CONTROL_STATE_TEXT[power_state]);
+  #ifdef USE_TAS5805M_TEXT_SENSOR
+  if (this->power_state_text_sensor_ != nullptr) this->power_state_text_sensor_->publish_state(CONTROL_STATE_TEXT[power_state]);
+  #endif
+}
+
+
+// any change in fault registers ends the active event, a new event is started
+// unless all fault registers are now zero
+void Tas5805mComponent::record_fault_event_(const uint8_t* faults) {
+  if (memcmp(faults, this->fault_event_registers_, 4) == 0) return;
+  memcpy(this->fault_event_registers_, faults, 4);
+
+  uint32_t now = millis();
+  Tas5805mFaultEvent* active = this->active_fault_event_();
+  if (active != nullptr) {
+    active->duration = now - active->onset;
+    active->active = false;
+  }
+
+  if ((faults[0] | faults[1] | faults[2] | faults[3]) != 0) {
+    Tas5805mFaultEvent* event = &this->fault_events_[this->fault_event_head_];
+    memcpy(event->registers, faults, 4);
+    event->onset = now;
+    event->duration = 0;
+    event->active = true;
+    event->cleared = false;
+    this->fault_event_head_ = (this->fault_event_head_ + 1) % FAULT_EVENT_HISTORY_SIZE;
+    if (this->fault_event_count_ < FAULT_EVENT_HISTORY_SIZE) this->fault_event_count_++;
+  }
+
+  #ifdef USE_TAS5805M_TEXT_SENSOR
+  if ((this->last_fault_event_text_sensor_ != nullptr) && (this->fault_event_count_ != 0)) {
+    char buffer[96];
+    this->format_fault_event_(this->fault_event(0), buffer, sizeof(buffer));
+    this->last_fault_event_text_sensor_->publish_state(buffer);
+  }
+  #endif
+}
+
+Tas5805mFaultEvent* Tas5805mComponent::active_fault_event_() {
+  if (this->fault_event_count_ == 0) return nullptr;
+  uint8_t last = (this->fault_event_head_ + FAULT_EVENT_HISTORY_SIZE - 1) % FAULT_EVENT_HISTORY_SIZE;
+  return this->fault_events_[last].active ? &this->fault_events_[last] : nullptr;
+}
+
+void Tas5805mComponent::format_fault_event_(const Tas5805mFaultEvent* event, char* buffer, size_t length) {
+  int written = snprintf(buffer, length, "CHAN 0x%02X GLOBAL1 0x%02X GLOBAL2 0x%02X OT 0x%02X at %us ",
+                         event->registers[0], event->registers[1], event->registers[2], event->registers[3],
+                         (unsigned) (event->onset / 1000));
+  if ((written < 0) || ((size_t) written >= length)) return;
+  if (event->active) {
+    snprintf(buffer + written, length - written, "active%s", event->cleared ? " cleared" : "");
+  } else {
+    snprintf(buffer + written, length - written, "for %ums%s", (unsigned) event->duration, event->cleared ? " cleared" : "");
+  }
+}
+
 
 // low level functions
 
@@ -4,6 +4,7 @@
 #include "esphome/core/component.h"
 #include "esphome/components/i2c/i2c.h"
 #include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
 #include "tas5805m_cfg.h"
 
 #ifdef USE_TAS5805M_EQ
@@ -14,6 +15,14 @@
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #endif
 
+#ifdef USE_TAS5805M_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+
+#ifdef USE_TAS5805M_TEXT_SENSOR
+#include "esphome/components/text_sensor/text_sensor.h"
+#endif
+
 namespace esphome::tas5805m {
 
 enum AutoRefreshMode : uint8_t {
@@ -21,11 +30,32 @@ enum AutoRefreshMode : uint8_t {
     BY_SWITCH = 1,
 };
 
+// steps of pop free mute and control state sequence
+enum SequenceStep : uint8_t {
+    SEQUENCE_IDLE = 0,
+    SEQUENCE_RAMP_DOWN,
+    SEQUENCE_MUTE,
+    SEQUENCE_RECONFIGURE,
+    SEQUENCE_CHANGE_STATE,
+    SEQUENCE_UNMUTE,
+    SEQUENCE_RAMP_UP,
+};
+
+enum DuckPhase : uint8_t {
+    DUCK_IDLE = 0,
+    DUCK_ATTACK,
+    DUCK_HOLD,
+    DUCK_RELEASE,
+};
+
 enum ExcludeIgnoreMode : uint8_t {
     NONE        = 0,
     CLOCK_FAULT = 1,
 };
 
+// number of level meter readings kept for 'get_level_history'
+static const uint8_t LEVEL_METER_HISTORY_SIZE = 16;
+
 class Tas5805mComponent : public audio_dac::AudioDac, public PollingComponent, public i2c::I2CDevice {
  public:
   void setup() override;
@@ -39,20 +69,95 @@ class Tas5805mComponent : public audio_dac::AudioDac, public PollingComponent, p
 
   void set_enable_pin(GPIOPin *enable) { this->enable_pin_ = enable; }
 
+  // used by 'Tas5805mGroup', settings are only refreshed once 'previous' has
+  // completed its refresh and fault polls and updates are offset by 'offset' ms
+  void set_refresh_after(Tas5805mComponent* previous) { this->refresh_after_ = previous; }
+  void set_fault_poll_offset(uint32_t offset) {
+    this->fault_poll_offset_ = offset;
+    this->fault_poll_staggered_ = true;
+  }
+  bool is_refresh_complete() { return this->refresh_settings_complete_; }
+  uint32_t fault_poll_min_interval() { return this->fault_poll_min_interval_; }
+
+  // FAULTZ is open drain and active low
+  void set_fault_pin(InternalGPIOPin *fault) { this->fault_pin_ = fault; }
+
   // optional YAML config
 
-  void config_analog_gain(float analog_gain) { this->tas5805m_analog_gain_ = analog_gain; }
+  void config_analog_gain(float analog_gain) {
+    this->tas5805m_analog_gain_ = analog_gain;
+    this->target_analog_gain_ = analog_gain;
+  }
+
+  void config_dac_mode(DacMode dac_mode) {
+    this->tas5805m_dac_mode_ = dac_mode;
+    this->target_dac_mode_ = dac_mode;
+  }
+
+  void config_level_meter_interval(uint32_t interval) { this->level_meter_interval_ = interval; }
+
+  // zero timeout disables the tier
+  void config_idle_hi_z_timeout(uint32_t timeout) { this->idle_hi_z_timeout_ = timeout; }
+  void config_idle_deep_sleep_timeout(uint32_t timeout) { this->idle_deep_sleep_timeout_ = timeout; }
+  void config_idle_level_threshold(float threshold_db) { this->idle_level_threshold_db_ = threshold_db; }
 
-  void config_dac_mode(DacMode dac_mode) {this->tas5805m_dac_mode_ = dac_mode; }
+  void config_fault_poll_interval(uint32_t min_interval, uint32_t max_interval) {
+    this->fault_poll_min_interval_ = min_interval;
+    this->fault_poll_max_interval_ = max_interval;
+    this->fault_poll_interval_ = min_interval;
+  }
+
+  // backoff doubles with each retry, lockout after 'max_retries' retries within 'window'
+  void config_fault_recovery(uint32_t backoff, uint8_t max_retries, uint32_t window) {
+    this->fault_recovery_backoff_ = backoff;
+    this->fault_recovery_max_retries_ = max_retries;
+    this->fault_recovery_window_ = window;
+  }
+
+  // left channel is read from 'slot', right channel from the following slot
+  // slots are one word length wide
+  void config_serial_audio_port(SerialFormat format, WordLength word_length, uint8_t slot) {
+    this->serial_format_ = format;
+    this->word_length_ = word_length;
+    this->tdm_slot_ = slot;
+  }
 
   void config_ignore_fault_mode(ExcludeIgnoreMode ignore_fault_mode) {
     this->ignore_clock_faults_when_clearing_faults_ = (ignore_fault_mode == ExcludeIgnoreMode::CLOCK_FAULT);
   }
 
-  void config_mixer_mode(MixerMode mixer_mode) {this->tas5805m_mixer_mode_ = mixer_mode; }
+  // fixed tas5805m pipeline latency in samples at the detected sample rate
+  void config_pipeline_latency(uint16_t samples) { this->pipeline_latency_samples_ = samples; }
+
+  void config_modulation_mode(ModulationMode modulation) {
+    this->tas5805m_modulation_mode_ = modulation;
+    this->target_modulation_mode_ = modulation;
+  }
+
+  void config_switching_frequency(SwitchingFrequency fsw) {
+    this->tas5805m_switching_frequency_ = fsw;
+    this->target_switching_frequency_ = fsw;
+  }
+
+  void config_mixer_mode(MixerMode mixer_mode) {
+    this->tas5805m_mixer_mode_ = mixer_mode;
+    this->mixer_mode_gains_(mixer_mode);
+  }
 
   void config_refresh_eq(AutoRefreshMode auto_refresh) { this->auto_refresh_ = auto_refresh; }
 
+  // zero step disables thermal foldback
+  void config_thermal_foldback(float step_db, float max_db, uint32_t interval, uint32_t hold) {
+    this->thermal_foldback_step_db_ = step_db;
+    this->thermal_foldback_max_db_ = max_db;
+    this->thermal_foldback_interval_ = interval;
+    this->thermal_foldback_hold_ = hold;
+  }
+
+  void config_volume_ramp(VolumeRampRate rate, VolumeRampStep step) {
+    this->tas5805m_volume_ramp_ = (rate << 6) | (step << 4) | (rate << 2) | step;
+  }
+
   void config_volume_max(float volume_max) {this->tas5805m_volume_max_ = (int8_t)(volume_max); }
   void config_volume_min(float volume_min) {this->tas5805m_volume_min_ = (int8_t)(volume_min); }
 
@@ -77,6 +182,30 @@ class Tas5805mComponent : public audio_dac::AudioDac, public PollingComponent, p
   }
   #endif
 
+  #ifdef USE_TAS5805M_SENSOR
+  SUB_SENSOR(left_channel_level)
+  SUB_SENSOR(right_channel_level)
+  SUB_SENSOR(hi_z_wake_latency)
+  SUB_SENSOR(deep_sleep_wake_latency)
+  SUB_SENSOR(fault_recovery_retries)
+  SUB_SENSOR(fault_recovery_lockouts)
+  SUB_SENSOR(thermal_foldback)
+  SUB_SENSOR(sample_rate)
+  SUB_SENSOR(bck_ratio)
+  SUB_SENSOR(clock_faults_per_minute)
+  SUB_SENSOR(clock_mtbg)
+  SUB_SENSOR(output_latency)
+
+  void config_left_channel_level_hysteresis(float hysteresis) { this->level_hysteresis_[0] = hysteresis; }
+  void config_right_channel_level_hysteresis(float hysteresis) { this->level_hysteresis_[1] = hysteresis; }
+  void config_level_publish_interval(uint32_t interval) { this->level_publish_interval_ = interval; }
+  #endif
+
+  #ifdef USE_TAS5805M_TEXT_SENSOR
+  SUB_TEXT_SENSOR(last_fault_event)
+  SUB_TEXT_SENSOR(power_state)
+  #endif
+
   void enable_dac(bool enable);
 
   bool enable_eq(bool enable);
@@ -85,22 +214,149 @@ class Tas5805mComponent : public audio_dac::AudioDac, public PollingComponent, p
   bool set_eq_gain(uint8_t band, int8_t gain);
   #endif
 
+  // level meter readings are shared by all consumers so each consumer
+  // does not need to issue its own i2c reads
+  // callback receives left and right levels in dBFS at 'level_meter_interval'
+  void add_on_level_meter_callback(std::function<void(float, float)> &&callback);
+
+  // total output latency in ms from the tas5805m pipeline and the group delay of the
+  // current eq gains, called with the new latency whenever it changes so audio
+  // players can compensate for it
+  float output_latency() { return this->output_latency_ms_; }
+  void add_on_output_latency_callback(std::function<void(float)> &&callback);
+
+  // copies up to 'max_levels' most recent readings, newest first, returns number copied
+  uint8_t get_level_history(Tas5805mLevel* levels, uint8_t max_levels);
+  bool get_latest_level(Tas5805mLevel* level);
+
+  // dsp volume words in book 5, applied on top of the digital volume
+  // balance is -1.0 (left only) to 1.0 (right only), channel volumes in dB
+  bool set_balance(float balance);
+  bool set_channel_volume(float left_db, float right_db);
+  bool set_left_channel_volume(float volume_db);
+  bool set_right_channel_volume(float volume_db);
+
+  // announcement ducking attenuates the dsp volume words so 'set_volume' is unaffected
+  // and the volume is restored exactly on release
+  // 'duration' of zero holds ducking until 'unduck'
+  // overlapping ducks use the deepest level and release once all have ended
+  bool duck(float level_db, uint32_t attack, uint32_t release, uint32_t duration);
+  bool unduck();
+  bool is_ducking() { return (this->duck_phase_ != DUCK_IDLE); }
+
+  // 2x2 mixer matrix with a dB gain per path, 'invert' phase inverts the path
+  // runtime changes are ramped to avoid clicks
+  // mixer mode presets are rejected if not valid for the configured dac mode
+  bool set_mixer_mode(MixerMode mode);
+  bool set_mixer_gain(MixerPath path, float gain_db, bool invert = false);
+  bool set_mixer_matrix(float l_to_l_db, float r_to_l_db, float l_to_r_db, float r_to_r_db,
+                        bool invert_l_to_l = false, bool invert_r_to_l = false,
+                        bool invert_l_to_r = false, bool invert_r_to_r = false);
+  MixerMode mixer_mode() { return this->tas5805m_mixer_mode_; }
+  float mixer_gain(MixerPath path) { return this->mixer_gain_db_[path]; }
+  bool is_mixer_inverted(MixerPath path) { return this->mixer_invert_[path]; }
+
+  // called after any change of mixer mode or mixer gains, so mixer select and numbers
+  // show changes made from lambdas, groups or each other
+  void add_on_mixer_callback(std::function<void()> &&callback);
+
+  float balance() { return this->tas5805m_balance_; }
+  float left_channel_volume() { return this->tas5805m_channel_volume_db_[0]; }
+  float right_channel_volume() { return this->tas5805m_channel_volume_db_[1]; }
+
   bool is_muted() override { return this->is_muted_; }
   bool set_mute_off() override;
   bool set_mute_on() override;
 
+  // pop free change of control state (PLAY, HI_Z, SLEEP or DEEP_SLEEP)
+  // volume is ramped down, tas5805m muted, control state changed then volume ramped back up
+  // sequence runs from the scheduler across 'loop' iterations and a new
+  // mute or control state command restarts it towards the new target
+  bool set_control_state(ControlState state);
+  bool is_sequence_running() { return (this->sequence_step_ != SEQUENCE_IDLE); }
+
+  // tiered idle power management enters Hi-Z after 'idle_hi_z_timeout' and deep sleep
+  // after 'idle_deep_sleep_timeout' without audio above 'idle_level_threshold' or i2s clock
+  // volume, mute off, fade and duck commands or a returning i2s clock wake to play
+  // explicit control state changes and 'enable_dac' are never overridden
+  bool wake();
+  PowerTier power_tier() { return this->power_tier_; }
+
+  // runtime dac mode and analog gain changes use the pop free sequencer
+  // to move through Hi-Z, apply the change and then return to the previous control state
+  // PBTL is rejected unless mixer mode is MONO, LEFT or RIGHT
+  bool set_dac_mode(DacMode mode);
+  bool set_analog_gain(float gain_db);
+  DacMode dac_mode() { return this->target_dac_mode_; }
+  float analog_gain() { return this->target_analog_gain_; }
+
+  // switching frequency and modulation mode are applied in Hi-Z like dac mode
+  bool set_switching_frequency(SwitchingFrequency fsw);
+  bool set_modulation_mode(ModulationMode modulation);
+  SwitchingFrequency switching_frequency() { return this->target_switching_frequency_; }
+  ModulationMode modulation_mode() { return this->target_modulation_mode_; }
+
   void refresh_settings();
 
   uint32_t times_faults_cleared();
 
+  // fault event history, index 0 is the most recent event
+  // nullptr when index is beyond the events recorded
+  uint8_t fault_event_count() { return this->fault_event_count_; }
+  const Tas5805mFaultEvent* fault_event(uint8_t index);
+  void clear_fault_events();
+  void dump_fault_events();
+
+  // read fault registers as soon as possible and poll quickly for a while
+  // used after volume and control state changes, can also be called from a lambda
+  void request_fault_check();
+
+  // over current and dc faults are recovered by clearing faults in Hi-Z then returning to
+  // the previous control state, repeated faults lock the tas5805m out in Hi-Z
+  // a lockout is reset by this, 'enable_dac' or 'set_control_state'
+  void reset_fault_recovery();
+  RecoveryState fault_recovery_state() { return this->recovery_state_; }
+
+  // i2s clock health, sampled with each fault poll
+  // a glitch is a new clock fault or loss of a detected sample rate
+  uint32_t sample_rate() { return this->clock_sample_rate_; }
+  uint16_t bck_ratio() { return this->clock_bck_ratio_; }
+  uint32_t clock_glitches() { return this->clock_glitches_; }
+  uint8_t clock_faults_per_minute();
+  float clock_mtbg();  // mean seconds between glitches, zero until two glitches
+
+  // power state read back from the tas5805m with each fault poll
+  ControlState power_state() { return this->tas5805m_power_state_; }
+
+  // dB of attenuation currently applied by thermal foldback
+  float thermal_foldback() { return this->thermal_foldback_db_; }
+
   bool use_eq_gain_refresh();
   bool use_eq_switch_refresh();
 
   float volume() override;
   bool set_volume(float value) override;
 
+  // fade digital volume to 'volume' over 'duration' ms using the tas5805m volume ramp
+  // a fade within the range of the hardware ramp is a single volume write
+  // 'set_volume' cancels a fade in progress
+  bool fade_to(float volume, uint32_t duration);
+  bool is_fading() { return (this->fade_steps_ != 0); }
+
+  // changes staged here are applied together at 'commit_time' ms since the epoch
+  // so rooms of a multi room system change in step, the system clock must be synchronised
+  // (for example by sntp), a later stage of the same setting replaces the earlier one
+  void stage_volume(float volume);
+  #ifdef USE_TAS5805M_EQ
+  bool stage_eq_gain(uint8_t band, int8_t gain);
+  #endif
+  bool commit_staged_at(uint64_t commit_time);
+  void cancel_staged();
+  bool is_commit_pending() { return (this->staged_commit_time_ != 0); }
+
  protected:
    GPIOPin* enable_pin_{nullptr};
+   InternalGPIOPin* fault_pin_{nullptr};
 
    bool configure_registers_();
 
@@ -108,7 +364,11 @@ class Tas5805mComponent : public audio_dac::AudioDac, public PollingComponent, p
    bool set_analog_gain_(float gain_db);
 
    bool get_dac_mode_(DacMode* mode);
-   bool set_dac_mode_(DacMode mode);
+   // writes switching frequency, dac mode and modulation mode together
+   bool write_device_ctrl_1_(SwitchingFrequency fsw, DacMode mode, ModulationMode modulation);
+
+   // SAP_CTRL1 and SAP_CTRL2
+   bool write_serial_audio_port_();
 
    bool set_deep_sleep_off_();
    bool set_deep_sleep_on_();
@@ -116,27 +376,113 @@ class Tas5805mComponent : public audio_dac::AudioDac, public PollingComponent, p
    bool get_digital_volume_(uint8_t* raw_volume);
    bool set_digital_volume_(uint8_t new_volume);
 
+   bool set_volume_ramp_(uint8_t volume_ramp);
+   void fade_step_();
+   void cancel_fade_();
+
+   void wait_for_commit_time_();
+   void commit_staged_();
+
    #ifdef USE_TAS5805M_EQ
    bool get_eq_(bool* enabled);
    #endif
 
+   bool write_channel_volume_();
+   void channel_volume_words_(uint8_t* words);
+
+   // dsp coefficient ram is treated as lost in deep sleep, so writes are deferred
+   // and blocks written before deep sleep are replayed once the dsp is running again
+   bool is_dsp_retained_() { return (this->tas5805m_control_state_ != CTRL_DEEP_SLEEP); }
+   void mark_dsp_lost_(uint8_t blocks);
+   bool replay_dsp_state_();
+
+   void start_duck_ramp_(float target_db, uint32_t ramp_time);
+   void duck_ramp_step_();
+   void check_duck_release_();
+
    bool set_eq_on_();
    bool set_eq_off_();
+   #ifdef USE_TAS5805M_EQ
+   // eq book must already be selected, page only changed when different to 'current_page'
+   bool write_eq_band_(uint8_t band, int8_t gain, uint8_t* current_page);
+   bool write_eq_coefficients_(uint8_t band, const RegisterSequenceEq* reg_value, uint8_t* current_page);
+   #endif
+
+   void update_power_management_();
+   bool is_audio_above_idle_level_();
+   void enter_power_tier_(PowerTier tier);
+
+   bool read_level_meter_(float* left_db, float* right_db);
+   void start_level_meter_();
+   void update_level_meter_();
+   #ifdef USE_TAS5805M_SENSOR
+   void publish_levels_();
+   #endif
 
    bool get_mixer_mode_(MixerMode *mode);
-   bool set_mixer_mode_(MixerMode mode);
+   void mixer_mode_gains_(MixerMode mode);
+
+   // mixer gains are linear with negative gain phase inverted
+   float mixer_target_gain_(uint8_t path);
+   bool write_mixer_gains_(const float* gains);
+   void start_mixer_ramp_();
+   void mixer_ramp_step_();
 
    bool get_state_(ControlState* state);
    bool set_state_(ControlState state);
 
+   // writes control state and mute bit together
+   bool write_device_ctrl_2_(ControlState state, bool mute);
+
+   // pop free sequencer
+   bool start_sequence_(ControlState target_state, bool target_mute);
+   void sequence_complete_();
+   bool next_sequence_step_(uint32_t* wait);
+   void run_sequence_();
+   ControlState target_control_state_();
+
    // manage faults
+   void fault_poll_();
+   uint32_t fault_poll_delay_(uint32_t interval);
+   bool process_faults_();
    bool clear_fault_registers_();
    bool read_fault_registers_();
 
+   // over current and dc fault recovery
+   void start_fault_recovery_();
+   void fault_recovery_retry_();
+   void publish_fault_recovery_();
+
+   void reconcile_power_state_(ControlState power_state);
+
+   // i2s clock health
+   void update_clock_health_();
+   void record_clock_glitch_();
+   bool is_clock_monitor_used_();
+   void publish_clock_health_();
+
+   // output latency
+   float eq_group_delay_ms_();
+   void update_output_latency_();
+
+   // thermal foldback
+   void thermal_foldback_step_();
+   void thermal_gain_ramp_step_();
+
+   // fault events are recorded when the fault registers change
+   void record_fault_event_(const uint8_t* faults);
+   Tas5805mFaultEvent* active_fault_event_();
+   void format_fault_event_(const Tas5805mFaultEvent* event, char* buffer, size_t length);
+
+   // FAULTZ interrupt only flags faults, fault registers are read in 'loop'
+   static void fault_isr_(Tas5805mComponent* component);
+   bool is_fault_pin_asserted_() { return (this->fault_pin_ != nullptr) && !this->fault_pin_->digital_read(); }
+
    #ifdef USE_TAS5805M_BINARY_SENSOR
    void publish_faults_();
-   void publish_channel_faults_();
-   void publish_global_faults_();
+   void publish_fault_sensors_();
+   uint16_t fault_sensor_bits_();
+   binary_sensor::BinarySensor* fault_binary_sensor_(uint8_t bit);
    #endif
 
    // low level functions
@@ -156,23 +502,85 @@ class Tas5805mComponent : public audio_dac::AudioDac, public PollingComponent, p
    AutoRefreshMode auto_refresh_;  // default 'BY_GAIN' = 0
 
    #ifdef USE_TAS5805M_BINARY_SENSOR
-   bool exclude_clock_fault_from_have_faults_; // YAML default = true
+   bool exclude_clock_fault_from_have_faults_{true}; // YAML default = true
    #endif
 
-   bool ignore_clock_faults_when_clearing_faults_; // YAML default = true
+   bool ignore_clock_faults_when_clearing_faults_{true}; // YAML default = true
 
    DacMode tas5805m_dac_mode_;
 
+   // serial audio port, defaults match TAS5805M reset values
+   SerialFormat serial_format_{FORMAT_I2S};
+   WordLength word_length_{WORD_LENGTH_24};
+   uint8_t tdm_slot_{0};
+
    float tas5805m_analog_gain_;
 
+   // init table sets 768kHz and BD modulation
+   SwitchingFrequency tas5805m_switching_frequency_{FSW_768KHZ};
+   ModulationMode tas5805m_modulation_mode_{MOD_BD};
+
    int8_t tas5805m_volume_max_;
    int8_t tas5805m_volume_min_;
 
+   // DIG_VOL_CTRL2 value, default is register reset value 0.5dB every FS period
+   uint8_t tas5805m_volume_ramp_{0x33};
+
    MixerMode tas5805m_mixer_mode_;
 
+   // mixer matrix indexed by 'MixerPath'
+   float mixer_gain_db_[4]{0.0, TAS5805M_MIN_MIXER_GAIN_DB, TAS5805M_MIN_MIXER_GAIN_DB, 0.0};
+   bool mixer_invert_[4]{false, false, false, false};
+   float mixer_written_gain_[4]{1.0, 0.0, 0.0, 1.0};  // linear gains last written
+   float mixer_ramp_from_gain_[4]{1.0, 0.0, 0.0, 1.0};
+   uint8_t mixer_ramp_index_{0};
+
+   // dsp volume words, 0dB and centred balance are the tas5805m defaults
+   float tas5805m_balance_{0.0};
+   float tas5805m_channel_volume_db_[2]{0.0, 0.0};  // index 0 = left channel, index 1 = right channel
+
+   // announcement ducking, 'duck_gain_db_' is added to both channel volumes
+   DuckPhase duck_phase_{DUCK_IDLE};
+   float duck_gain_db_{0.0};
+   float duck_level_db_{0.0};
+   float duck_ramp_from_db_{0.0};
+   float duck_ramp_to_db_{0.0};
+   uint16_t duck_ramp_steps_{0};
+   uint16_t duck_ramp_index_{0};
+   uint8_t duck_holds_{0};          // ducks without a duration waiting for 'unduck'
+   uint32_t duck_hold_until_{0};    // millis() when ducks with a duration have ended
+   uint32_t duck_release_{0};       // ms release time of most recent duck
+
+   // POWER_STATE read back, published when changed
+   // 'tas5805m_control_state_' stays the requested state while a fault has shut the tas5805m down
+   ControlState tas5805m_power_state_{CTRL_DEEP_SLEEP};
+   bool power_state_read_{false};
+   bool fault_shutdown_{false};                 // power state below requested state with a shutdown fault
+   bool power_state_restore_pending_{false};    // requested state is written again after the fault cleared
+
+   // i2s clock health
+   uint32_t clock_sample_rate_{0};
+   uint16_t clock_bck_ratio_{0};
+   bool clock_fault_seen_{false};                     // clock fault at last fault read
+   uint32_t clock_glitches_{0};
+   uint32_t first_clock_glitch_{0};                   // millis()
+   uint32_t clock_glitch_times_[CLOCK_GLITCH_HISTORY_SIZE]{0};
+   uint8_t clock_glitch_head_{0};
+
+   // thermal foldback, 'thermal_gain_db_' is added to both channel volumes and
+   // ramped towards minus 'thermal_foldback_db_'
+   float thermal_foldback_step_db_{3.0};
+   float thermal_foldback_max_db_{12.0};
+   uint32_t thermal_foldback_interval_{10000};
+   uint32_t thermal_foldback_hold_{60000};
+   float thermal_foldback_db_{0.0};
+   float thermal_gain_db_{0.0};
+   bool thermal_foldback_running_{false};
+   uint32_t last_thermal_warning_{0};   // millis() when over temperature warning was last read
+
    // used if eq gain numbers are defined in YAML
    #ifdef USE_TAS5805M_EQ
-   bool tas5805m_eq_enabled_;
+   bool tas5805m_eq_enabled_{false};
    int8_t tas5805m_eq_gain_[NUMBER_EQ_BANDS]{0};
    #endif
 
@@ -182,9 +590,85 @@ class Tas5805mComponent : public audio_dac::AudioDac, public PollingComponent, p
    uint8_t tas5805m_raw_volume_max_;
    uint8_t tas5805m_raw_volume_min_;
 
+   // last digital volume and volume ramp written, initialised to tas5805m_minimal.h values
+   uint8_t tas5805m_raw_volume_{0x30};
+   uint8_t tas5805m_current_volume_ramp_{0x33};
+
+   // mute bit as last written to DEVICE_CTRL_2, 'is_muted_' is the requested mute state
+   bool tas5805m_device_muted_{false};
+
+   // pop free sequence in progress
+   SequenceStep sequence_step_{SEQUENCE_IDLE};
+   ControlState sequence_target_state_{CTRL_PLAY};
+   bool sequence_target_mute_{false};
+
+   // idle power management, 'power_tier_' is only set when the component entered the tier
+   uint32_t idle_hi_z_timeout_{0};
+   uint32_t idle_deep_sleep_timeout_{0};
+   float idle_level_threshold_db_{-70.0};
+   uint32_t last_activity_{0};
+   bool clock_present_{false};
+   PowerTier power_tier_{POWER_TIER_NONE};
+   PowerTier wake_tier_{POWER_TIER_NONE};  // tier being woken from, for wake latency
+   uint32_t wake_start_us_{0};
+
+   // staged changes, 'staged_commit_time_' is zero when no commit is scheduled
+   // volume and eq coefficients are resolved when staged
+   uint64_t staged_commit_time_{0};
+   bool staged_volume_set_{false};
+   uint8_t staged_raw_volume_{0};
+   #ifdef USE_TAS5805M_EQ
+   uint16_t staged_eq_bands_{0};
+   int8_t staged_eq_gain_[NUMBER_EQ_BANDS]{0};
+   const RegisterSequenceEq* staged_eq_registers_[NUMBER_EQ_BANDS]{nullptr};
+   #endif
+
+   // dsp blocks and eq bands that need replaying before the dsp is used
+   uint8_t dsp_blocks_lost_{0};
+   uint16_t eq_bands_lost_{0};
+
+   // device ctrl 1 settings and analog gain applied in Hi-Z by sequencer step SEQUENCE_RECONFIGURE
+   bool reconfigure_pending_{false};
+   DacMode target_dac_mode_{BTL};
+   float target_analog_gain_{TAS5805M_MIN_ANALOG_GAIN};
+   SwitchingFrequency target_switching_frequency_{FSW_768KHZ};
+   ModulationMode target_modulation_mode_{MOD_BD};
+   uint8_t sequence_restore_raw_volume_{0x30};
+
+   // fade in progress, 'fade_steps_' is zero when not fading
+   uint8_t fade_start_raw_{0};
+   uint8_t fade_target_raw_{0};
+   uint16_t fade_steps_{0};
+   uint16_t fade_step_index_{0};
+
    // fault processing
    bool is_fault_to_clear_{false}; // false so clear fault registers is skipped on first update
 
+   // over current and dc fault recovery
+   RecoveryState recovery_state_{RECOVERY_IDLE};
+   ControlState recovery_return_state_{CTRL_PLAY};
+   uint32_t fault_recovery_backoff_{1000};
+   uint8_t fault_recovery_max_retries_{3};
+   uint32_t fault_recovery_window_{60000};
+   uint32_t recovery_window_start_{0};
+   uint8_t recovery_retries_{0};              // retries in current window
+   uint32_t recovery_lockouts_{0};
+
+   // set by FAULTZ interrupt
+   volatile bool fault_interrupt_{false};
+
+   // adaptive fault polling, interval doubles from min to max while no faults are seen
+   uint32_t fault_poll_min_interval_{250};
+   uint32_t fault_poll_max_interval_{10000};
+   uint32_t fault_poll_interval_{250};
+   uint32_t fault_poll_offset_{0};
+   bool fault_poll_staggered_{false};
+
+   // amplifier group member to complete its refresh of settings first
+   // and when this member triggered its refresh, so it does not wait forever
+   Tas5805mComponent* refresh_after_{nullptr};
+   uint32_t refresh_triggered_time_{0};
+
    // has the state of any fault in group changed - used to conditionally publish binary sensors
    // true so all binary sensors are published on first update
    bool is_new_channel_fault_{true};
@@ -195,9 +679,22 @@ class Tas5805mComponent : public audio_dac::AudioDac, public PollingComponent, p
    // current state of faults
    Tas5805mFault tas5805m_faults_;
 
+   #ifdef USE_TAS5805M_BINARY_SENSOR
+   // fault binary sensor states last published, all published on first update
+   uint16_t published_fault_bits_{0};
+   uint16_t unpublished_fault_bits_{(1 << FAULT_SENSOR_COUNT) - 1};
+   #endif
+
    // counts number of times the faults register is cleared (used for publishing to sensor)
    uint32_t times_faults_cleared_{0};
 
+   // ring buffer of fault events, 'fault_event_head_' is where the next event is written
+   Tas5805mFaultEvent fault_events_[FAULT_EVENT_HISTORY_SIZE];
+   uint8_t fault_event_head_{0};
+   uint8_t fault_event_count_{0};
+   // fault registers at last read
+   uint8_t fault_event_registers_[4]{0};
+
    // only ever changed to true once when mixer mode is written
    // used by 'loop'
    bool mixer_mode_configured_{false};
@@ -236,6 +733,37 @@ class Tas5805mComponent : public audio_dac::AudioDac, public PollingComponent, p
 
    // initialised in loop, used for delay in starting 'update'
    uint32_t start_time_;
+
+   // level meter
+   // ms between level meter reads while there are level meter callbacks
+   uint32_t level_meter_interval_{50};
+
+   // ring buffer of most recent level meter readings
+   Tas5805mLevel level_history_[LEVEL_METER_HISTORY_SIZE];
+   uint8_t level_history_head_{0};
+   uint8_t level_history_count_{0};
+
+   CallbackManager<void(float, float)> level_meter_callback_{};
+
+   // output latency, negative until first calculated
+   float output_latency_ms_{-1.0};
+   uint16_t pipeline_latency_samples_{TAS5805M_PIPELINE_LATENCY_SAMPLES};
+   bool output_latency_tracked_{false};    // sample rate is read for output latency callbacks
+   CallbackManager<void(float)> output_latency_callback_{};
+
+   CallbackManager<void()> mixer_callback_{};
+
+   #ifdef USE_TAS5805M_SENSOR
+   // ms between publishing level sensors
+   uint32_t level_publish_interval_{5000};
+
+   // index 0 = left channel, index 1 = right channel
+   float level_hysteresis_[2]{1.0, 1.0};
+   float last_published_level_[2]{NAN, NAN};  // NAN so first level is always published
+
+   uint32_t level_reads_per_publish_{1};
+   uint32_t level_read_counter_{0};
+   #endif
 };
 
 }  // namespace esphome::tas5805m
@@ -9,11 +9,91 @@ namespace esphome::tas5805m {
     CTRL_PLAY       = 0x03, // Play
    };
 
+  static const char* const CONTROL_STATE_TEXT[] = {"DEEP_SLEEP", "SLEEP", "HI_Z", "PLAY"};
+
   enum DacMode : uint8_t {
     BTL  = 0, // Bridge tied load
     PBTL = 1, // Parallel load
   };
 
+  // DEVICE_CTRL_1 FSW_SEL bits 6:4, other values are reserved
+  enum SwitchingFrequency : uint8_t {
+    FSW_768KHZ = 0x00,
+    FSW_384KHZ = 0x02,
+    FSW_480KHZ = 0x03,
+    FSW_576KHZ = 0x04,
+  };
+
+  // SAP_CTRL1 DATA_FORMAT bits 5:4
+  enum SerialFormat : uint8_t {
+    FORMAT_I2S = 0x00,
+    FORMAT_TDM = 0x01,                         // TDM/DSP, channels start at the slot data offset
+    FORMAT_RJ  = 0x02,                         // right justified, word length must match sample bits
+    FORMAT_LJ  = 0x03,                         // left justified
+  };
+
+  static const char* const SERIAL_FORMAT_TEXT[] = {"I2S", "TDM", "RJ", "LJ"};
+
+  // SAP_CTRL1 WORD_LENGTH bits 1:0
+  enum WordLength : uint8_t {
+    WORD_LENGTH_16 = 0x00,
+    WORD_LENGTH_20 = 0x01,
+    WORD_LENGTH_24 = 0x02,
+    WORD_LENGTH_32 = 0x03,
+  };
+
+  static const uint8_t WORD_LENGTH_BITS[] = {16, 20, 24, 32};
+
+  // DEVICE_CTRL_1 DAMP_MOD bits 1:0
+  enum ModulationMode : uint8_t {
+    MOD_BD     = 0x00,
+    MOD_1SPW   = 0x01,
+    MOD_HYBRID = 0x02,
+  };
+
+  static const char* const MODULATION_MODE_TEXT[] = {"BD", "1SPW", "HYBRID"};
+
+  // idle power tier entered automatically by the component
+  enum PowerTier : uint8_t {
+    POWER_TIER_NONE = 0,
+    POWER_TIER_HI_Z,
+    POWER_TIER_DEEP_SLEEP,
+  };
+
+  static const char* const POWER_TIER_TEXT[] = {"NONE", "HI_Z", "DEEP_SLEEP"};
+
+  // over current and dc fault recovery
+  enum RecoveryState : uint8_t {
+    RECOVERY_IDLE = 0,
+    RECOVERY_BACKOFF,                          // in Hi-Z waiting to clear faults and retry
+    RECOVERY_LOCKOUT,                          // left in Hi-Z after too many retries
+  };
+
+  static const char* const RECOVERY_STATE_TEXT[] = {"IDLE", "BACKOFF", "LOCKOUT"};
+
+  // dsp coefficient blocks shadowed by the component, replayed if lost in deep sleep
+  enum DspBlock : uint8_t {
+    DSP_BLOCK_MIXER  = 1 << 0,
+    DSP_BLOCK_VOLUME = 1 << 1,
+    DSP_BLOCK_EQ     = 1 << 2,
+  };
+
+  // DIG_VOL_CTRL2 ramp rate, volume updated every 1, 2 or 4 FS periods or set directly
+  enum VolumeRampRate : uint8_t {
+    RAMP_RATE_1FS     = 0,
+    RAMP_RATE_2FS     = 1,
+    RAMP_RATE_4FS     = 2,
+    RAMP_RATE_INSTANT = 3,
+  };
+
+  // DIG_VOL_CTRL2 ramp step per update
+  enum VolumeRampStep : uint8_t {
+    RAMP_STEP_4DB   = 0,
+    RAMP_STEP_2DB   = 1,
+    RAMP_STEP_1DB   = 2,
+    RAMP_STEP_0_5DB = 3,
+  };
+
   enum MixerMode : uint8_t {
     STEREO = 0,
     STEREO_INVERSE,
@@ -24,6 +104,16 @@ namespace esphome::tas5805m {
 
   static const char* const MIXER_MODE_TEXT[] = {"STEREO", "STEREO_INVERSE", "MONO", "RIGHT", "LEFT"};
 
+  // order matches mixer gain registers so gains are written in one burst
+  enum MixerPath : uint8_t {
+    MIXER_LEFT_TO_LEFT = 0,
+    MIXER_RIGHT_TO_LEFT,
+    MIXER_LEFT_TO_RIGHT,
+    MIXER_RIGHT_TO_RIGHT,
+  };
+
+  static const char* const MIXER_PATH_TEXT[] = {"L-L", "R-L", "L-R", "R-R"};
+
   struct Tas5805mConfiguration {
     uint8_t offset;
     uint8_t value;
@@ -44,9 +134,56 @@ namespace esphome::tas5805m {
     #endif
   };
 
+  // fault registers CHAN_FAULT, GLOBAL_FAULT1, GLOBAL_FAULT2 and OT_WARNING while the event was active
+  struct Tas5805mFaultEvent {
+    uint8_t registers[4]{0};
+    uint32_t onset{0};                         // millis() when first read
+    uint32_t duration{0};                      // ms, zero while active
+    bool active{false};
+    bool cleared{false};                       // fault registers were cleared during the event
+  };
+
+  // bit positions of fault binary sensor states, channel faults match CHAN_FAULT register bits
+  enum FaultSensorBit : uint8_t {
+    FAULT_SENSOR_RIGHT_OVER_CURRENT = 0,
+    FAULT_SENSOR_LEFT_OVER_CURRENT,
+    FAULT_SENSOR_RIGHT_DC,
+    FAULT_SENSOR_LEFT_DC,
+    FAULT_SENSOR_PVDD_UNDER_VOLTAGE,
+    FAULT_SENSOR_PVDD_OVER_VOLTAGE,
+    FAULT_SENSOR_BQ_WRITE_FAILED,
+    FAULT_SENSOR_OTP_CRC_CHECK,
+    FAULT_SENSOR_CLOCK,
+    FAULT_SENSOR_OVER_TEMPERATURE_SHUTDOWN,
+    FAULT_SENSOR_OVER_TEMPERATURE_WARNING,
+    FAULT_SENSOR_HAVE_FAULT,
+    FAULT_SENSOR_COUNT,
+  };
+
+  struct Tas5805mLevel {
+    uint32_t timestamp{0};                     // millis() when level meter was read
+    float left{0.0};                           // dBFS
+    float right{0.0};                          // dBFS
+  };
+
+// number of fault events kept in fault event history
+static const uint8_t FAULT_EVENT_HISTORY_SIZE          = 16;
+
+// number of clock glitch times kept for clock faults per minute
+static const uint8_t CLOCK_GLITCH_HISTORY_SIZE         = 16;
+
+// output latency, the tas5805m pipeline latency is not given in the datasheet so the default
+// in samples at the detected sample rate is an estimate, set by 'pipeline_latency' once measured
+// eq group delay is calculated from the eq coefficients at the reference frequency
+static const uint16_t TAS5805M_PIPELINE_LATENCY_SAMPLES = 48;
+static const uint16_t LATENCY_REFERENCE_FREQUENCY       = 1000;  // Hz
+
 // Startup sequence codes
 static const uint8_t TAS5805M_CFG_META_DELAY           = 254;
 
+// DIG_VOL_CTRL value which mutes digital volume
+static const uint8_t TAS5805M_DIGITAL_VOLUME_MUTE      = 0xFF;
+
 static const float TAS5805M_MIN_ANALOG_GAIN            = -15.5;
 static const float TAS5805M_MAX_ANALOG_GAIN            = 0.0;
 
@@ -58,20 +195,31 @@ static const uint8_t TAS5805M_REG_PAGE_ZERO            = 0x00;
 
 // tas5805m registers
 static const uint8_t TAS5805M_DEVICE_CTRL_1            = 0x02;
+static const uint8_t TAS5805M_DAMP_PBTL                = 1 << 2;
 static const uint8_t TAS5805M_DEVICE_CTRL_2            = 0x03;
+static const uint8_t TAS5805M_SAP_CTRL1                = 0x33;
+static const uint8_t TAS5805M_SAP_OFFSET_MSB           = 1 << 7;  // bit 8 of 9 bit data offset, lsb in SAP_CTRL2
+static const uint8_t TAS5805M_SAP_CTRL2                = 0x34;
+static const uint16_t TAS5805M_MAX_SAP_OFFSET          = 511;     // bck cycles from start of frame
 static const uint8_t TAS5805M_FS_MON                   = 0x37;
 static const uint8_t TAS5805M_BCK_MON                  = 0x38;
+static const uint8_t TAS5805M_FS_MON_FS_MASK           = 0x0F;  // zero when no valid i2s clock
+static const uint8_t TAS5805M_FS_MON_BCK_RATIO_MASK    = 0x30;  // 2 msb of bck ratio, lsb in BCK_MON
 static const uint8_t TAS5805M_DIG_VOL_CTRL             = 0x4C;
+static const uint8_t TAS5805M_DIG_VOL_CTRL2            = 0x4E;
 static const uint8_t TAS5805M_ANA_CTRL                 = 0x53;
 static const uint8_t TAS5805M_AGAIN                    = 0x54;
 static const uint8_t TAS5805M_DSP_MISC                 = 0x66;
 static const uint8_t TAS5805M_POWER_STATE              = 0x68;
+static const uint8_t TAS5805M_POWER_STATE_MASK         = 0x03;  // STATE_RPT, same values as ControlState
 
 // TAS5805M_REG_FAULT register values
 static const uint8_t TAS5805M_CHAN_FAULT               = 0x70;
 static const uint8_t TAS5805M_GLOBAL_FAULT1            = 0x71;
 static const uint8_t TAS5805M_GLOBAL_FAULT2            = 0x72;
 static const uint8_t TAS5805M_OT_WARNING               = 0x73;
+// POWER_STATE to OT_WARNING are read in one 12 byte burst with each fault poll
+static const uint8_t TAS5805M_STATUS_READ_BYTES        = TAS5805M_OT_WARNING - TAS5805M_POWER_STATE + 1;
 static const uint8_t TAS5805M_FAULT_CLEAR              = 0x78;
 static const uint8_t TAS5805M_ANALOG_FAULT_CLEAR       = 0x80;
 
@@ -79,7 +227,13 @@ static const uint8_t TAS5805M_ANALOG_FAULT_CLEAR       = 0x80;
 static const uint8_t  TAS5805M_CTRL_EQ_ON              = 0x00;
 static const uint8_t  TAS5805M_CTRL_EQ_OFF             = 0x01;
 
-// Level meter register
+// Level meter registers
+// left and right level meter words are adjacent so both are read in one 8 byte burst
+static const uint8_t TAS5805M_REG_BOOK_LEVEL_METER     = 0x78;
+static const uint8_t TAS5805M_REG_LEVEL_METER_PAGE     = 0x02;
+static const uint8_t TAS5805M_REG_LEFT_LEVEL_METER     = 0x60;
+static const uint8_t TAS5805M_REG_RIGHT_LEVEL_METER    = 0x64;
+static const float   TAS5805M_LEVEL_METER_FLOOR_DB     = -120.0;  // reported when level meter word is zero
 
 // Mixer registers
 static const uint8_t TAS5805M_REG_BOOK_5               = 0x8C;
@@ -91,9 +245,12 @@ static const uint8_t TAS5805M_REG_RIGHT_TO_RIGHT_GAIN  = 0x24;
 static const uint8_t TAS5805M_REG_BOOK_5_VOLUME_PAGE   = 0x2A;
 static const uint8_t TAS5805M_REG_LEFT_VOLUME          = 0x24;
 static const uint8_t TAS5805M_REG_RIGHT_VOLUME         = 0x28;
-static const uint32_t TAS5805M_MIXER_VALUE_MUTE        = 0x00000000;
-static const uint32_t TAS5805M_MIXER_VALUE_0DB         = 0x00008000;
-//static const uint32_t TAS5805M_MIXER_VALUE_MINUS6DB    = 0xE7264000;
-static const uint32_t TAS5805M_MIXER_VALUE_MINUS6DB    = 0x00004000;
+// dsp left and right volume words are adjacent so both are written in one 8 byte burst
+static const float   TAS5805M_MIN_CHANNEL_VOLUME_DB    = -103.0;
+static const float   TAS5805M_MAX_CHANNEL_VOLUME_DB    = 24.0;
+// mixer gains are adjacent 9.23 words so all four paths are written in one 16 byte burst
+// gains at or below the minimum mute the path
+static const float   TAS5805M_MIN_MIXER_GAIN_DB        = -103.0;
+static const float   TAS5805M_MAX_MIXER_GAIN_DB        = 24.0;
 
 }  // namespace esphome::tas5805m
@@ -34,6 +34,10 @@ namespace esphome::tas5805m {
 	  20, 32, 50, 80, 125, 200, 315, 500, 800, 1250, 2000, 3150, 5000, 8000, 16000
   };
 
+  // eq coefficients are designed for the 96kHz processing rate of the dsp,
+  // band centres are only at the frequencies above at this rate
+  static const uint32_t TAS5805M_EQ_SAMPLE_RATE = 96000;
+
   struct RegisterSequenceEq {
 	  uint8_t page;
 	  uint8_t offset1;
@@ -1499,7 +1503,7 @@ namespace esphome::tas5805m {
 			{ 0x26, 0x40, 20, 0x00, 0x1a, 0xeb, 0x86, 0x5b, 0xfc, 0x17, 0x9b, 0xa8, 0xec, 0xe5, 0x42, 0x56, 0x03, 0xe8, 0x64, 0x58, 0x00, 0x2f, 0x37, 0x4f },
 	};
 
-  static const RegisterSequenceEq* TAS5805M_EQ_REGISTERS[] = {
+  static const RegisterSequenceEq* const TAS5805M_EQ_REGISTERS[] = {
 	  TAS5805M_EQ_REGISTERS_MF,
 	  TAS5805M_EQ_REGISTERS_ME,
 	  TAS5805M_EQ_REGISTERS_MD,
@@ -0,0 +1,169 @@
+#include "tas5805m_group.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+
+namespace esphome::tas5805m {
+
+static const char *const TAG = "tas5805m.group";
+
+void Tas5805mGroup::setup() {
+  // fault polls of members are spread evenly over the fastest poll interval
+  uint8_t number_amps = this->amps_.size();
+  for (uint8_t i = 0; i < number_amps; i++) {
+    Tas5805mComponent* amp = this->amps_[i];
+    amp->set_fault_poll_offset(i * amp->fault_poll_min_interval() / number_amps);
+    if (i > 0) amp->set_refresh_after(this->amps_[i - 1]);
+  }
+}
+
+void Tas5805mGroup::dump_config() {
+  ESP_LOGCONFIG(TAG, "Tas5805m Group:");
+  for (auto* amp : this->amps_) {
+    ESP_LOGCONFIG(TAG, "  Amp: 0x%02X", amp->get_i2c_address());
+  }
+}
+
+bool Tas5805mGroup::set_mute_off() {
+  this->is_muted_ = false;
+  bool ok = true;
+  for (auto* amp : this->amps_) ok &= amp->set_mute_off();
+  return ok;
+}
+
+bool Tas5805mGroup::set_mute_on() {
+  this->is_muted_ = true;
+  bool ok = true;
+  for (auto* amp : this->amps_) ok &= amp->set_mute_on();
+  return ok;
+}
+
+// members are always set to the same volume
+float Tas5805mGroup::volume() {
+  return this->amps_.empty() ? 0.0f : this->amps_[0]->volume();
+}
+
+bool Tas5805mGroup::set_volume(float volume) {
+  bool ok = true;
+  for (auto* amp : this->amps_) ok &= amp->set_volume(volume);
+  return ok;
+}
+
+bool Tas5805mGroup::fade_to(float volume, uint32_t duration) {
+  bool ok = true;
+  for (auto* amp : this->amps_) ok &= amp->fade_to(volume, duration);
+  return ok;
+}
+
+bool Tas5805mGroup::duck(float level_db, uint32_t attack, uint32_t release, uint32_t duration) {
+  bool ok = true;
+  for (auto* amp : this->amps_) ok &= amp->duck(level_db, attack, release, duration);
+  return ok;
+}
+
+bool Tas5805mGroup::unduck() {
+  bool ok = true;
+  for (auto* amp : this->amps_) ok &= amp->unduck();
+  return ok;
+}
+
+void Tas5805mGroup::enable_dac(bool enable) {
+  for (auto* amp : this->amps_) amp->enable_dac(enable);
+}
+
+bool Tas5805mGroup::set_control_state(ControlState state) {
+  bool ok = true;
+  for (auto* amp : this->amps_) ok &= amp->set_control_state(state);
+  return ok;
+}
+
+bool Tas5805mGroup::set_mixer_mode(MixerMode mode) {
+  bool ok = true;
+  for (auto* amp : this->amps_) ok &= amp->set_mixer_mode(mode);
+  return ok;
+}
+
+bool Tas5805mGroup::set_dac_mode(DacMode mode) {
+  bool ok = true;
+  for (auto* amp : this->amps_) ok &= amp->set_dac_mode(mode);
+  return ok;
+}
+
+bool Tas5805mGroup::set_analog_gain(float gain_db) {
+  bool ok = true;
+  for (auto* amp : this->amps_) ok &= amp->set_analog_gain(gain_db);
+  return ok;
+}
+
+bool Tas5805mGroup::set_switching_frequency(SwitchingFrequency fsw) {
+  bool ok = true;
+  for (auto* amp : this->amps_) ok &= amp->set_switching_frequency(fsw);
+  return ok;
+}
+
+bool Tas5805mGroup::set_modulation_mode(ModulationMode modulation) {
+  bool ok = true;
+  for (auto* amp : this->amps_) ok &= amp->set_modulation_mode(modulation);
+  return ok;
+}
+
+bool Tas5805mGroup::set_balance(float balance) {
+  bool ok = true;
+  for (auto* amp : this->amps_) ok &= amp->set_balance(balance);
+  return ok;
+}
+
+bool Tas5805mGroup::set_channel_volume(float left_db, float right_db) {
+  bool ok = true;
+  for (auto* amp : this->amps_) ok &= amp->set_channel_volume(left_db, right_db);
+  return ok;
+}
+
+bool Tas5805mGroup::enable_eq(bool enable) {
+  bool ok = true;
+  for (auto* amp : this->amps_) ok &= amp->enable_eq(enable);
+  return ok;
+}
+
+#ifdef USE_TAS5805M_EQ
+bool Tas5805mGroup::set_eq_gain(uint8_t band, int8_t gain) {
+  bool ok = true;
+  for (auto* amp : this->amps_) ok &= amp->set_eq_gain(band, gain);
+  return ok;
+}
+#endif
+
+void Tas5805mGroup::stage_volume(float volume) {
+  for (auto* amp : this->amps_) amp->stage_volume(volume);
+}
+
+#ifdef USE_TAS5805M_EQ
+bool Tas5805mGroup::stage_eq_gain(uint8_t band, int8_t gain) {
+  bool ok = true;
+  for (auto* amp : this->amps_) ok &= amp->stage_eq_gain(band, gain);
+  return ok;
+}
+#endif
+
+bool Tas5805mGroup::commit_staged_at(uint64_t commit_time) {
+  bool ok = true;
+  for (auto* amp : this->amps_) ok &= amp->commit_staged_at(commit_time);
+  return ok;
+}
+
+void Tas5805mGroup::cancel_staged() {
+  for (auto* amp : this->amps_) amp->cancel_staged();
+}
+
+float Tas5805mGroup::output_latency() {
+  float latency = 0.0f;
+  for (auto* amp : this->amps_) latency = std::max(latency, amp->output_latency());
+  return latency;
+}
+
+// members check now, their following polls fall back into their own staggered slots
+void Tas5805mGroup::request_fault_check() {
+  for (auto* amp : this->amps_) amp->request_fault_check();
+}
+
+}  // namespace esphome::tas5805m
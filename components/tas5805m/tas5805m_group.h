@@ -0,0 +1,67 @@
+#pragma once
+
+#include "esphome/components/audio_dac/audio_dac.h"
+#include "esphome/core/component.h"
+#include "tas5805m.h"
+
+#include <vector>
+
+namespace esphome::tas5805m {
+
+// several tas5805m on one i2c bus driven as one audio dac
+// settings are applied to every member in one pass, members refresh their boot settings
+// one after another and fault polls are staggered so peak bus use does not grow with amp count
+// all members share the one flash copy of the eq coefficient tables
+class Tas5805mGroup : public audio_dac::AudioDac, public Component {
+ public:
+  void setup() override;
+  void dump_config() override;
+
+  // after the members
+  float get_setup_priority() const override { return setup_priority::DATA; }
+
+  void add_amp(Tas5805mComponent* amp) { this->amps_.push_back(amp); }
+
+  bool is_muted() override { return this->is_muted_; }
+  bool set_mute_off() override;
+  bool set_mute_on() override;
+
+  float volume() override;
+  bool set_volume(float volume) override;
+
+  bool fade_to(float volume, uint32_t duration);
+  bool duck(float level_db, uint32_t attack, uint32_t release, uint32_t duration);
+  bool unduck();
+
+  void enable_dac(bool enable);
+  bool set_control_state(ControlState state);
+  bool set_mixer_mode(MixerMode mode);
+  bool set_dac_mode(DacMode mode);
+  bool set_analog_gain(float gain_db);
+  bool set_switching_frequency(SwitchingFrequency fsw);
+  bool set_modulation_mode(ModulationMode modulation);
+  bool set_balance(float balance);
+  bool set_channel_volume(float left_db, float right_db);
+
+  bool enable_eq(bool enable);
+  #ifdef USE_TAS5805M_EQ
+  bool set_eq_gain(uint8_t band, int8_t gain);
+  #endif
+
+  void stage_volume(float volume);
+  #ifdef USE_TAS5805M_EQ
+  bool stage_eq_gain(uint8_t band, int8_t gain);
+  #endif
+  bool commit_staged_at(uint64_t commit_time);
+  void cancel_staged();
+
+  // largest output latency of the members in ms
+  float output_latency();
+
+  void request_fault_check();
+
+ protected:
+  std::vector<Tas5805mComponent*> amps_;
+};
+
+}  // namespace esphome::tas5805m
@@ -0,0 +1,39 @@
+import esphome.codegen as cg
+from esphome.components import text_sensor
+import esphome.config_validation as cv
+from esphome.const import (
+    ENTITY_CATEGORY_DIAGNOSTIC,
+)
+
+CONF_LAST_FAULT_EVENT = "last_fault_event"
+CONF_POWER_STATE = "power_state"
+
+ICON_ALERT = "mdi:alert-circle-outline"
+ICON_POWER = "mdi:power-settings"
+
+from .audio_dac import CONF_TAS5805M_ID, Tas5805mComponent
+
+CONFIG_SCHEMA = {
+    cv.GenerateID(CONF_TAS5805M_ID): cv.use_id(Tas5805mComponent),
+
+    cv.Optional(CONF_LAST_FAULT_EVENT): text_sensor.text_sensor_schema(
+        icon=ICON_ALERT,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
+    cv.Optional(CONF_POWER_STATE): text_sensor.text_sensor_schema(
+        icon=ICON_POWER,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
+}
+
+async def to_code(config):
+    cg.add_define("USE_TAS5805M_TEXT_SENSOR")
+    tas5805m_component = await cg.get_variable(config[CONF_TAS5805M_ID])
+
+    if fault_event_config := config.get(CONF_LAST_FAULT_EVENT):
+        sens = await text_sensor.new_text_sensor(fault_event_config)
+        cg.add(tas5805m_component.set_last_fault_event_text_sensor(sens))
+
+    if power_state_config := config.get(CONF_POWER_STATE):
+        sens = await text_sensor.new_text_sensor(power_state_config)
+        cg.add(tas5805m_component.set_power_state_text_sensor(sens))
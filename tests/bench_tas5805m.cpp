@@ -0,0 +1,138 @@
+// i2c bus cost of each public operation of the tas5805m component, measured on the mock bus
+// and written as JSON to stdout or to the file given as the first argument
+//
+// bus time is modelled as 9 bits per byte (8 data bits and ack) including the device address
+// byte, plus 2 bits for the start and stop conditions of each transaction
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "tas5805m_harness.h"
+
+using namespace esphome;
+using namespace esphome::tas5805m;
+using namespace esphome::tas5805m::testing;
+
+static const uint32_t BUS_FREQUENCIES[] = {100000, 400000, 1000000};
+static const char *const BUS_FREQUENCY_NAMES[] = {"100kHz", "400kHz", "1MHz"};
+
+struct BusCost {
+  uint32_t transactions{0};
+  uint32_t bytes{0};
+};
+
+static BusCost measure(MockTas5805mBus &bus, const std::function<void()> &operation) {
+  bus.reset_counters();
+  operation();
+  BusCost cost;
+  cost.transactions = bus.write_transactions + bus.read_transactions;
+  cost.bytes = bus.bytes_written + bus.bytes_read + cost.transactions;
+  return cost;
+}
+
+static double bus_time_us(const BusCost &cost, uint32_t frequency) {
+  double bits = (cost.bytes * 9.0) + (cost.transactions * 2.0);
+  return (bits * 1000000.0) / frequency;
+}
+
+static void write_cost(FILE *out, const BusCost &cost) {
+  std::fprintf(out, "\"transactions\": %u, \"bytes\": %u, \"time_us\": {", cost.transactions, cost.bytes);
+  for (uint8_t i = 0; i < 3; i++) {
+    std::fprintf(out, "%s\"%s\": %.1f", i ? ", " : "", BUS_FREQUENCY_NAMES[i], bus_time_us(cost, BUS_FREQUENCIES[i]));
+  }
+  std::fprintf(out, "}");
+}
+
+struct Operation {
+  std::string name;
+  BusCost cost;
+};
+
+int main(int argc, char **argv) {
+  FILE *out = stdout;
+  if (argc > 1) {
+    out = std::fopen(argv[1], "w");
+    if (out == nullptr) {
+      std::perror(argv[1]);
+      return 1;
+    }
+  }
+
+  std::vector<Operation> operations;
+  Tas5805mHarness h;
+  // fault polls are measured on their own, not while measuring other operations
+  h.dac.config_fault_poll_interval(600000, 600000);
+
+  operations.push_back({"setup", measure(h.bus, [&]() { h.setup(); })});
+
+  operations.push_back({"loop_refresh", measure(h.bus, [&]() {
+    h.dac.refresh_settings();
+    for (uint32_t ms = 0; (ms < 1000) && !h.dac.is_refresh_complete(); ms++) h.run_for(1);
+  })});
+
+  // past the initial update delay, so the first fault poll has run
+  h.run_for(6000);
+
+  operations.push_back({"update_fault_poll", measure(h.bus, [&]() {
+    h.dac.request_fault_check();
+    h.run_for(1);
+  })});
+
+  operations.push_back({"set_volume", measure(h.bus, [&]() { h.dac.set_volume(0.5f); })});
+
+  operations.push_back({"mute_on", measure(h.bus, [&]() {
+    h.dac.set_mute_on();
+    h.run_for(500);
+  })});
+  operations.push_back({"mute_off", measure(h.bus, [&]() {
+    h.dac.set_mute_off();
+    h.run_for(500);
+  })});
+
+  // mode changes include their gain ramp
+  const MixerMode modes[] = {STEREO_INVERSE, MONO, LEFT, RIGHT, STEREO};
+  for (MixerMode mode : modes) {
+    operations.push_back({std::string("set_mixer_mode_") + MIXER_MODE_TEXT[mode], measure(h.bus, [&]() {
+      h.dac.set_mixer_mode(mode);
+      h.run_for(1000);
+    })});
+  }
+
+  std::vector<std::pair<int, BusCost>> eq_costs[NUMBER_EQ_BANDS];
+  BusCost eq_total;
+  BusCost eq_max;
+  for (int8_t gain = TAS5805M_EQ_MIN_DB; gain <= TAS5805M_EQ_MAX_DB; gain++) {
+    for (uint8_t band = 0; band < NUMBER_EQ_BANDS; band++) {
+      BusCost cost = measure(h.bus, [&]() { h.dac.set_eq_gain(band, gain); });
+      eq_costs[band].emplace_back(gain, cost);
+      eq_total.transactions += cost.transactions;
+      eq_total.bytes += cost.bytes;
+      if (bus_time_us(cost, BUS_FREQUENCIES[0]) > bus_time_us(eq_max, BUS_FREQUENCIES[0])) eq_max = cost;
+    }
+  }
+
+  std::fprintf(out, "{\n  \"operations\": {\n");
+  for (size_t i = 0; i < operations.size(); i++) {
+    std::fprintf(out, "    \"%s\": {", operations[i].name.c_str());
+    write_cost(out, operations[i].cost);
+    std::fprintf(out, "},\n");
+  }
+  std::fprintf(out, "    \"set_eq_gain_all_entries\": {");
+  write_cost(out, eq_total);
+  std::fprintf(out, "},\n    \"set_eq_gain_max_entry\": {");
+  write_cost(out, eq_max);
+  std::fprintf(out, "}\n  },\n  \"set_eq_gain\": [\n");
+  for (uint8_t band = 0; band < NUMBER_EQ_BANDS; band++) {
+    for (size_t i = 0; i < eq_costs[band].size(); i++) {
+      bool last = (band == NUMBER_EQ_BANDS - 1) && (i == eq_costs[band].size() - 1);
+      std::fprintf(out, "    {\"band_hz\": %u, \"gain_db\": %d, ", TAS5805M_EQ_BANDS[band], eq_costs[band][i].first);
+      write_cost(out, eq_costs[band][i].second);
+      std::fprintf(out, "}%s\n", last ? "" : ",");
+    }
+  }
+  std::fprintf(out, "  ]\n}\n");
+
+  if (out != stdout) std::fclose(out);
+  return 0;
+}
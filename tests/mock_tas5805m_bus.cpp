@@ -0,0 +1,93 @@
+#include "mock_tas5805m_bus.h"
+
+namespace esphome::tas5805m::testing {
+
+static const uint8_t PAGE_SET          = 0x00;
+static const uint8_t BOOK_SET          = 0x7F;
+static const uint8_t DEVICE_CTRL_2     = 0x03;
+static const uint8_t POWER_STATE       = 0x68;
+static const uint8_t CHAN_FAULT        = 0x70;
+static const uint8_t GLOBAL_FAULT1     = 0x71;
+static const uint8_t OT_WARNING        = 0x73;
+static const uint8_t FAULT_CLEAR       = 0x78;
+static const uint8_t ANALOG_FAULT_CLEAR = 0x80;
+static const uint8_t CLOCK_FAULT       = 0x04;
+
+// the first byte sets the register pointer, following bytes are written with auto increment
+i2c::ErrorCode MockTas5805mBus::write(uint8_t address, const uint8_t *buffer, size_t len, bool stop) {
+  (void) address;
+  (void) stop;
+  if (this->fail) return i2c::ERROR_NOT_ACKNOWLEDGED;
+  if ((len > 1) && this->failing_writes_.count(key_(this->book_, this->page_, buffer[0]))) return i2c::ERROR_NOT_ACKNOWLEDGED;
+  this->write_transactions++;
+  this->bytes_written += len;
+  if (len == 0) return i2c::ERROR_OK;
+
+  this->pointer_ = buffer[0];
+  for (size_t i = 1; i < len; i++) {
+    uint8_t reg = this->pointer_++;
+    uint8_t value = buffer[i];
+    this->registers_[key_(this->book_, this->page_, reg)] = value;
+    this->write_counts_[key_(this->book_, this->page_, reg)]++;
+
+    if (reg == PAGE_SET) {
+      this->page_ = value;
+    } else if ((reg == BOOK_SET) && (this->page_ == 0)) {
+      this->book_ = value;
+    } else if ((this->book_ == 0) && (this->page_ == 0)) {
+      // power state reports the control state written, faults are latched until cleared
+      if (reg == DEVICE_CTRL_2) this->set(POWER_STATE, value & 0x03);
+      if ((reg == FAULT_CLEAR) && (value & ANALOG_FAULT_CLEAR)) {
+        for (uint8_t fault = CHAN_FAULT; fault <= OT_WARNING; fault++) this->set(fault, 0);
+      }
+    }
+  }
+  return i2c::ERROR_OK;
+}
+
+i2c::ErrorCode MockTas5805mBus::read(uint8_t address, uint8_t *buffer, size_t len) {
+  (void) address;
+  if (this->fail) return i2c::ERROR_NOT_ACKNOWLEDGED;
+  this->read_transactions++;
+  this->bytes_read += len;
+  this->read_counts_[key_(this->book_, this->page_, this->pointer_)]++;
+  if (!this->clock_present) this->set(GLOBAL_FAULT1, this->get(GLOBAL_FAULT1) | CLOCK_FAULT);
+  for (size_t i = 0; i < len; i++) buffer[i] = this->get(this->book_, this->page_, this->pointer_++);
+  return i2c::ERROR_OK;
+}
+
+uint8_t MockTas5805mBus::get(uint8_t book, uint8_t page, uint8_t reg) const {
+  auto it = this->registers_.find(key_(book, page, reg));
+  return (it == this->registers_.end()) ? 0 : it->second;
+}
+
+void MockTas5805mBus::set(uint8_t book, uint8_t page, uint8_t reg, uint8_t value) {
+  this->registers_[key_(book, page, reg)] = value;
+}
+
+std::vector<uint8_t> MockTas5805mBus::get_bytes(uint8_t book, uint8_t page, uint8_t reg, uint8_t len) const {
+  std::vector<uint8_t> bytes;
+  for (uint8_t i = 0; i < len; i++) bytes.push_back(this->get(book, page, reg + i));
+  return bytes;
+}
+
+uint32_t MockTas5805mBus::writes_to(uint8_t book, uint8_t page, uint8_t reg) const {
+  auto it = this->write_counts_.find(key_(book, page, reg));
+  return (it == this->write_counts_.end()) ? 0 : it->second;
+}
+
+uint32_t MockTas5805mBus::reads_from(uint8_t book, uint8_t page, uint8_t reg) const {
+  auto it = this->read_counts_.find(key_(book, page, reg));
+  return (it == this->read_counts_.end()) ? 0 : it->second;
+}
+
+void MockTas5805mBus::reset_counters() {
+  this->write_transactions = 0;
+  this->read_transactions = 0;
+  this->bytes_written = 0;
+  this->bytes_read = 0;
+  this->write_counts_.clear();
+  this->read_counts_.clear();
+}
+
+}  // namespace esphome::tas5805m::testing
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "esphome/components/i2c/i2c.h"
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace esphome::tas5805m::testing {
+
+// i2c bus with a tas5805m register space, registers are addressed by book, page and offset
+// the page register 0x00 selects a page in any book, the book register 0x7F is only at page 0
+// counts every transaction so tests and benchmarks can measure bus cost
+class MockTas5805mBus : public i2c::I2CBus {
+ public:
+  i2c::ErrorCode write(uint8_t address, const uint8_t *buffer, size_t len, bool stop) override;
+  i2c::ErrorCode read(uint8_t address, uint8_t *buffer, size_t len) override;
+
+  uint8_t get(uint8_t book, uint8_t page, uint8_t reg) const;
+  void set(uint8_t book, uint8_t page, uint8_t reg, uint8_t value);
+  std::vector<uint8_t> get_bytes(uint8_t book, uint8_t page, uint8_t reg, uint8_t len) const;
+
+  // control port registers, book 0 page 0
+  uint8_t get(uint8_t reg) const { return this->get(0, 0, reg); }
+  void set(uint8_t reg, uint8_t value) { this->set(0, 0, reg, value); }
+
+  // number of data bytes written to a register since counters were reset
+  uint32_t writes_to(uint8_t book, uint8_t page, uint8_t reg) const;
+  // number of reads starting at a register since counters were reset
+  uint32_t reads_from(uint8_t book, uint8_t page, uint8_t reg) const;
+
+  void reset_counters();
+
+  // book and page currently selected
+  uint8_t book() const { return this->book_; }
+  uint8_t page() const { return this->page_; }
+
+  // every transaction is not acknowledged while set
+  bool fail{false};
+
+  // writes starting at a register are not acknowledged until 'reset_write_failures()'
+  void fail_writes_to(uint8_t book, uint8_t page, uint8_t reg) { this->failing_writes_.insert(key_(book, page, reg)); }
+  void reset_write_failures() { this->failing_writes_.clear(); }
+
+  // while there is no i2s clock the clock fault is latched again whenever faults are read,
+  // so it is only ever seen clear after a fault clear while the clock is present
+  bool clock_present{true};
+
+  uint32_t write_transactions{0};
+  uint32_t read_transactions{0};
+  uint32_t bytes_written{0};   // including register address bytes, excluding device address
+  uint32_t bytes_read{0};
+
+ protected:
+  static uint32_t key_(uint8_t book, uint8_t page, uint8_t reg) { return (book << 16) | (page << 8) | reg; }
+
+  std::map<uint32_t, uint8_t> registers_;
+  std::map<uint32_t, uint32_t> write_counts_;
+  std::map<uint32_t, uint32_t> read_counts_;
+  std::set<uint32_t> failing_writes_;
+  uint8_t book_{0};
+  uint8_t page_{0};
+  uint8_t pointer_{0};
+};
+
+}  // namespace esphome::tas5805m::testing
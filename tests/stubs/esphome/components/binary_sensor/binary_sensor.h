@@ -0,0 +1,19 @@
+#pragma once
+#include <string>
+namespace esphome::binary_sensor {
+class BinarySensor {
+ public:
+  void publish_state(bool state) { this->state = state; this->has_state_ = true; this->publish_count++; }
+  bool has_state() const { return this->has_state_; }
+  bool state{false};
+  int publish_count{0};
+ protected:
+  bool has_state_{false};
+};
+}  // namespace esphome::binary_sensor
+#define LOG_BINARY_SENSOR(prefix, type, obj) ((void)(obj))
+#define SUB_BINARY_SENSOR(name) \
+ protected: \
+  binary_sensor::BinarySensor *name##_binary_sensor_{nullptr}; \
+ public: \
+  void set_##name##_binary_sensor(binary_sensor::BinarySensor *binary_sensor) { this->name##_binary_sensor_ = binary_sensor; }
@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+namespace esphome::i2c {
+enum ErrorCode {
+  NO_ERROR = 0,
+  ERROR_OK = 0,
+  ERROR_INVALID_ARGUMENT = 1,
+  ERROR_NOT_ACKNOWLEDGED = 2,
+  ERROR_TIMEOUT = 3,
+  ERROR_NOT_INITIALIZED = 4,
+  ERROR_TOO_LARGE = 5,
+  ERROR_UNKNOWN = 6,
+  ERROR_CRC = 7,
+};
+class I2CBus {
+ public:
+  virtual ~I2CBus() = default;
+  virtual ErrorCode write(uint8_t address, const uint8_t *buffer, size_t len, bool stop) = 0;
+  virtual ErrorCode read(uint8_t address, uint8_t *buffer, size_t len) = 0;
+};
+class I2CDevice {
+ public:
+  void set_i2c_address(uint8_t address) { this->address_ = address; }
+  void set_i2c_bus(I2CBus *bus) { this->bus_ = bus; }
+  uint8_t get_i2c_address() const { return this->address_; }
+  I2CBus *get_i2c_bus() const { return this->bus_; }
+  ErrorCode write(const uint8_t *data, size_t len, bool stop = true) { return this->bus_->write(this->address_, data, len, stop); }
+  ErrorCode read(uint8_t *data, size_t len) { return this->bus_->read(this->address_, data, len); }
+  ErrorCode read_register(uint8_t a_register, uint8_t *data, size_t len, bool stop = true) {
+    ErrorCode err = this->write(&a_register, 1, stop);
+    if (err != ERROR_OK) return err;
+    return this->read(data, len);
+  }
+  ErrorCode write_register(uint8_t a_register, const uint8_t *data, size_t len, bool stop = true) {
+    uint8_t buffer[260];
+    if (len + 1 > sizeof(buffer)) return ERROR_TOO_LARGE;
+    buffer[0] = a_register;
+    for (size_t i = 0; i < len; i++) buffer[i + 1] = data[i];
+    return this->write(buffer, len + 1, stop);
+  }
+ protected:
+  uint8_t address_{0x00};
+  I2CBus *bus_{nullptr};
+};
+}  // namespace esphome::i2c
+#define LOG_I2C_DEVICE(this) ((void)(this))
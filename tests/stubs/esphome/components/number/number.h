@@ -0,0 +1,33 @@
+#pragma once
+#include <cstdint>
+#include <string>
+namespace esphome::number {
+class Number;
+class NumberCall {
+ public:
+  explicit NumberCall(Number *parent) : parent_(parent) {}
+  NumberCall &set_value(float value) { this->value_ = value; return *this; }
+  void perform();
+ protected:
+  Number *parent_;
+  float value_{0};
+};
+class Number {
+ public:
+  virtual ~Number() = default;
+  void publish_state(float state) { this->state = state; this->has_state_ = true; }
+  NumberCall make_call() { return NumberCall(this); }
+  std::string get_name() const { return this->name_; }
+  void set_name(const std::string &name) { this->name_ = name; }
+  uint32_t get_object_id_hash() { return reinterpret_cast<uintptr_t>(this) & 0xFFFFFFFF; }
+  bool has_state() const { return this->has_state_; }
+  float state{0};
+  friend class NumberCall;
+ protected:
+  virtual void control(float value) = 0;
+  bool has_state_{false};
+  std::string name_{"number"};
+};
+inline void NumberCall::perform() { this->parent_->control(this->value_); }
+}  // namespace esphome::number
+#define LOG_NUMBER(prefix, type, obj) ((void)(obj))
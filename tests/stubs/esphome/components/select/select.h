@@ -0,0 +1,31 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "esphome/core/helpers.h"
+namespace esphome::select {
+class Select {
+ public:
+  virtual ~Select() = default;
+  void publish_state(const std::string &state) { this->state = state; this->has_state_ = true; }
+  void traits_set_options(std::vector<std::string> options) { this->options_ = options; }
+  optional<size_t> index_of(const std::string &option) const {
+    for (size_t i = 0; i < this->options_.size(); i++) if (this->options_[i] == option) return i;
+    return {};
+  }
+  optional<std::string> at(size_t index) const {
+    if (index < this->options_.size()) return this->options_[index];
+    return {};
+  }
+  uint32_t get_object_id_hash() { return reinterpret_cast<uintptr_t>(this) & 0xFFFFFFFF; }
+  std::string get_name() const { return "select"; }
+  bool has_state() const { return this->has_state_; }
+  void call_control(const std::string &value) { this->control(value); }
+  std::string state;
+ protected:
+  virtual void control(const std::string &value) = 0;
+  std::vector<std::string> options_;
+  bool has_state_{false};
+};
+}  // namespace esphome::select
+#define LOG_SELECT(prefix, type, obj) ((void)(obj))
@@ -0,0 +1,20 @@
+#pragma once
+#include <cmath>
+namespace esphome::sensor {
+class Sensor {
+ public:
+  void publish_state(float state) { this->state = state; this->has_state_ = true; this->publish_count++; }
+  bool has_state() const { return this->has_state_; }
+  float get_state() const { return this->state; }
+  float state{NAN};
+  int publish_count{0};
+ protected:
+  bool has_state_{false};
+};
+}  // namespace esphome::sensor
+#define LOG_SENSOR(prefix, type, obj) ((void)(obj))
+#define SUB_SENSOR(name) \
+ protected: \
+  sensor::Sensor *name##_sensor_{nullptr}; \
+ public: \
+  void set_##name##_sensor(sensor::Sensor *sensor) { this->name##_sensor_ = sensor; }
@@ -0,0 +1,21 @@
+#pragma once
+#include <string>
+#include "esphome/core/helpers.h"
+namespace esphome::switch_ {
+enum SwitchRestoreMode : uint8_t { SWITCH_RESTORE_DEFAULT_OFF, SWITCH_RESTORE_DEFAULT_ON, SWITCH_ALWAYS_OFF, SWITCH_ALWAYS_ON };
+class Switch {
+ public:
+  virtual ~Switch() = default;
+  void publish_state(bool state) { this->state = state; }
+  void turn_on() { this->write_state(true); }
+  void turn_off() { this->write_state(false); }
+  optional<bool> get_initial_state_with_restore_mode() { return this->initial_state_; }
+  void set_initial_state(optional<bool> state) { this->initial_state_ = state; }
+  std::string get_name() const { return "switch"; }
+  bool state{false};
+ protected:
+  virtual void write_state(bool state) = 0;
+  optional<bool> initial_state_{};
+};
+}  // namespace esphome::switch_
+#define LOG_SWITCH(prefix, type, obj) ((void)(obj))
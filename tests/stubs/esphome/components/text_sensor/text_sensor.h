@@ -0,0 +1,19 @@
+#pragma once
+#include <string>
+namespace esphome::text_sensor {
+class TextSensor {
+ public:
+  void publish_state(const std::string &state) { this->state = state; this->has_state_ = true; this->publish_count++; }
+  bool has_state() const { return this->has_state_; }
+  std::string state;
+  int publish_count{0};
+ protected:
+  bool has_state_{false};
+};
+}  // namespace esphome::text_sensor
+#define LOG_TEXT_SENSOR(prefix, type, obj) ((void)(obj))
+#define SUB_TEXT_SENSOR(name) \
+ protected: \
+  text_sensor::TextSensor *name##_text_sensor_{nullptr}; \
+ public: \
+  void set_##name##_text_sensor(text_sensor::TextSensor *text_sensor) { this->name##_text_sensor_ = text_sensor; }
@@ -0,0 +1,41 @@
+#pragma once
+#include <functional>
+#include <tuple>
+#include "esphome/core/helpers.h"
+namespace esphome {
+template<typename T, typename... X> class TemplatableValue {
+ public:
+  TemplatableValue() = default;
+  TemplatableValue(T value) : value_(value), has_value_(true) {}
+  TemplatableValue(std::function<T(X...)> f) : f_(f), has_value_(true), is_lambda_(true) {}
+  bool has_value() const { return has_value_; }
+  T value(X... x) { return is_lambda_ ? f_(x...) : value_; }
+ protected:
+  T value_{};
+  std::function<T(X...)> f_;
+  bool has_value_{false};
+  bool is_lambda_{false};
+};
+#define TEMPLATABLE_VALUE_(type, name) \
+ protected: \
+  TemplatableValue<type, Ts...> name##_{}; \
+ public: \
+  template<typename V> void set_##name(V name) { this->name##_ = name; }
+#define TEMPLATABLE_VALUE(type, name) TEMPLATABLE_VALUE_(type, name)
+template<typename... Ts> class Action {
+ public:
+  virtual ~Action() = default;
+  virtual void play_complex(Ts... x) { this->play(x...); }
+ protected:
+  virtual void play(Ts... x) = 0;
+};
+template<typename... Ts> class Condition {
+ public:
+  virtual ~Condition() = default;
+  virtual bool check(Ts... x) = 0;
+};
+template<typename... Ts> class Trigger {
+ public:
+  void trigger(Ts... x) { (void) sizeof...(x); }
+};
+}  // namespace esphome
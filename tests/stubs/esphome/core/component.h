@@ -0,0 +1,79 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include "esphome/core/helpers.h"
+namespace esphome {
+namespace setup_priority {
+static const float BUS = 1000.0f;
+static const float IO = 900.0f;
+static const float HARDWARE = 800.0f;
+static const float DATA = 600.0f;
+static const float PROCESSOR = 400.0f;
+static const float BLUETOOTH = 350.0f;
+static const float AFTER_BLUETOOTH = 300.0f;
+static const float WIFI = 250.0f;
+static const float ETHERNET = 250.0f;
+static const float BEFORE_CONNECTION = 220.0f;
+static const float AFTER_WIFI = 200.0f;
+static const float AFTER_CONNECTION = 100.0f;
+static const float LATE = -100.0f;
+}  // namespace setup_priority
+class Component {
+ public:
+  virtual ~Component() = default;
+  virtual void setup() {}
+  virtual void loop() {}
+  virtual void dump_config() {}
+  virtual float get_setup_priority() const { return setup_priority::DATA; }
+  void mark_failed() { this->failed_ = true; }
+  bool is_failed() const { return this->failed_; }
+  void disable_loop() { this->loop_enabled_ = false; }
+  void enable_loop() { this->loop_enabled_ = true; }
+  void enable_loop_soon_any_context() { this->loop_enabled_ = true; }
+  bool is_loop_enabled() const { return this->loop_enabled_; }
+  void status_set_warning(const char * = nullptr) { this->warning_ = true; }
+  void status_clear_warning() { this->warning_ = false; }
+  bool status_has_warning() const { return this->warning_; }
+  // test helpers: run scheduled callbacks whose time has come
+  void run_scheduler(uint32_t now);
+  bool has_timeout(const std::string &name) const { return this->timeouts_.count(name) != 0; }
+  bool has_interval(const std::string &name) const { return this->intervals_.count(name) != 0; }
+  uint32_t interval_period(const std::string &name) const {
+    auto it = this->intervals_.find(name);
+    return it == this->intervals_.end() ? 0 : it->second.period;
+  }
+ protected:
+  void set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f);
+  void set_timeout(uint32_t timeout, std::function<void()> &&f) { this->set_timeout(std::string(), timeout, std::move(f)); }
+  bool cancel_timeout(const std::string &name) { return this->timeouts_.erase(name) != 0; }
+  void set_interval(const std::string &name, uint32_t interval, std::function<void()> &&f);
+  void set_interval(uint32_t interval, std::function<void()> &&f) { this->set_interval(std::string(), interval, std::move(f)); }
+  bool cancel_interval(const std::string &name) { return this->intervals_.erase(name) != 0; }
+  struct Scheduled {
+    uint32_t next;
+    uint32_t period;
+    std::function<void()> f;
+    uint32_t id;        // distinguishes an item from a later one with the same name
+  };
+  std::map<std::string, Scheduled> timeouts_;
+  std::map<std::string, Scheduled> intervals_;
+  bool failed_{false};
+  bool loop_enabled_{true};
+  bool warning_{false};
+};
+class PollingComponent : public Component {
+ public:
+  PollingComponent() : PollingComponent(0) {}
+  explicit PollingComponent(uint32_t update_interval) : update_interval_(update_interval) {}
+  virtual void update() = 0;
+  virtual void set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
+  virtual uint32_t get_update_interval() const { return this->update_interval_; }
+  void start_poller();
+  void stop_poller() { this->cancel_interval("update"); }
+  void call_setup() { this->setup(); this->start_poller(); }
+ protected:
+  uint32_t update_interval_;
+};
+}  // namespace esphome
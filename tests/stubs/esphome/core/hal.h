@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+#include <string>
+namespace esphome {
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+// host test helpers: virtual clock advanced by 'delay' and the test harness
+void stub_set_micros(uint32_t us);
+void stub_advance_micros(uint32_t us);
+namespace gpio {
+enum InterruptType : uint8_t { INTERRUPT_RISING_EDGE = 1, INTERRUPT_FALLING_EDGE = 2, INTERRUPT_ANY_EDGE = 3, INTERRUPT_LOW_LEVEL = 4, INTERRUPT_HIGH_LEVEL = 5 };
+}
+class GPIOPin {
+ public:
+  virtual ~GPIOPin() = default;
+  virtual void setup() {}
+  virtual void pin_mode(uint8_t) {}
+  virtual bool digital_read() { return this->state_; }
+  virtual void digital_write(bool value) { this->state_ = value; }
+  virtual std::string dump_summary() const { return "stub"; }
+ protected:
+  bool state_{false};
+};
+class ISRInternalGPIOPin {};
+class InternalGPIOPin : public GPIOPin {
+ public:
+  template<typename T> void attach_interrupt(void (*func)(T *), T *arg, gpio::InterruptType type) const {
+    this->isr_func_ = reinterpret_cast<void (*)(void *)>(func);
+    this->isr_arg_ = arg;
+    (void) type;
+  }
+  virtual void detach_interrupt() const { this->isr_func_ = nullptr; }
+  ISRInternalGPIOPin to_isr() const { return {}; }
+  void fire_interrupt() const { if (this->isr_func_ != nullptr) this->isr_func_(this->isr_arg_); }
+ protected:
+  mutable void (*isr_func_)(void *){nullptr};
+  mutable void *isr_arg_{nullptr};
+};
+}  // namespace esphome
+#define IRAM_ATTR
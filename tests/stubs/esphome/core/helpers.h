@@ -0,0 +1,40 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+namespace esphome {
+template<typename T> using optional = std::optional<T>;
+using std::clamp;
+template<typename T, typename U> T remap(U value, U min, U max, T min_out, T max_out) {
+  return (value - min) * (max_out - min_out) / (max - min) + min_out;
+}
+template<typename... Ts> class CallbackManager;
+template<typename... Ts> class CallbackManager<void(Ts...)> {
+ public:
+  void add(std::function<void(Ts...)> &&callback) { this->callbacks_.push_back(std::move(callback)); }
+  void call(Ts... args) { for (auto &cb : this->callbacks_) cb(args...); }
+  size_t size() const { return this->callbacks_.size(); }
+  bool empty() const { return this->callbacks_.empty(); }
+  void operator()(Ts... args) { call(args...); }
+ protected:
+  std::vector<std::function<void(Ts...)>> callbacks_;
+};
+template<typename T> class Parented {
+ public:
+  Parented() {}
+  Parented(T *parent) : parent_(parent) {}
+  T *get_parent() const { return parent_; }
+  void set_parent(T *parent) { parent_ = parent; }
+ protected:
+  T *parent_{nullptr};
+};
+constexpr uint32_t encode_uint32(uint8_t byte1, uint8_t byte2, uint8_t byte3, uint8_t byte4) {
+  return (static_cast<uint32_t>(byte1) << 24) | (static_cast<uint32_t>(byte2) << 16) | (static_cast<uint32_t>(byte3) << 8) | static_cast<uint32_t>(byte4);
+}
+constexpr uint16_t encode_uint16(uint8_t msb, uint8_t lsb) { return (static_cast<uint16_t>(msb) << 8) | lsb; }
+inline std::string str_sprintf(const char *fmt, ...) { return fmt; }
+}  // namespace esphome
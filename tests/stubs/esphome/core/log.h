@@ -0,0 +1,23 @@
+#pragma once
+#include <cstdio>
+#define ESPHOME_LOG_LEVEL_NONE 0
+#define ESPHOME_LOG_LEVEL_ERROR 1
+#define ESPHOME_LOG_LEVEL_WARN 2
+#define ESPHOME_LOG_LEVEL_INFO 3
+#define ESPHOME_LOG_LEVEL_CONFIG 4
+#define ESPHOME_LOG_LEVEL_DEBUG 5
+#define ESPHOME_LOG_LEVEL_VERBOSE 6
+#define ESPHOME_LOG_LEVEL_VERY_VERBOSE 7
+#ifndef ESPHOME_LOG_LEVEL
+#define ESPHOME_LOG_LEVEL ESPHOME_LOG_LEVEL_VERY_VERBOSE
+#endif
+#define ESP_LOG_STUB_(lvl, tag, ...) do { if (0) std::printf(__VA_ARGS__); } while (0)
+#define ESP_LOGE(tag, ...) ESP_LOG_STUB_(1, tag, __VA_ARGS__)
+#define ESP_LOGW(tag, ...) ESP_LOG_STUB_(2, tag, __VA_ARGS__)
+#define ESP_LOGI(tag, ...) ESP_LOG_STUB_(3, tag, __VA_ARGS__)
+#define ESP_LOGCONFIG(tag, ...) ESP_LOG_STUB_(4, tag, __VA_ARGS__)
+#define ESP_LOGD(tag, ...) ESP_LOG_STUB_(5, tag, __VA_ARGS__)
+#define ESP_LOGV(tag, ...) ESP_LOG_STUB_(6, tag, __VA_ARGS__)
+#define ESP_LOGVV(tag, ...) ESP_LOG_STUB_(7, tag, __VA_ARGS__)
+#define LOG_UPDATE_INTERVAL(this) ((void)(this))
+#define LOG_PIN(prefix, pin) ((void)(pin))
@@ -0,0 +1,30 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <vector>
+namespace esphome {
+class ESPPreferenceObject {
+ public:
+  ESPPreferenceObject() = default;
+  explicit ESPPreferenceObject(std::vector<uint8_t> *slot) : slot_(slot) {}
+  template<typename T> bool save(const T *src) {
+    if (slot_ == nullptr) return false;
+    slot_->assign(reinterpret_cast<const uint8_t *>(src), reinterpret_cast<const uint8_t *>(src) + sizeof(T));
+    return true;
+  }
+  template<typename T> bool load(T *dest) {
+    if (slot_ == nullptr || slot_->size() != sizeof(T)) return false;
+    std::memcpy(dest, slot_->data(), sizeof(T));
+    return true;
+  }
+ protected:
+  std::vector<uint8_t> *slot_{nullptr};
+};
+class ESPPreferences {
+ public:
+  template<typename T> ESPPreferenceObject make_preference(uint32_t hash, bool = false) { return ESPPreferenceObject(&store_[hash]); }
+  std::map<uint32_t, std::vector<uint8_t>> store_;
+};
+extern ESPPreferences *global_preferences;
+}  // namespace esphome
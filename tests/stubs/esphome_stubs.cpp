@@ -0,0 +1,67 @@
+// host implementations of the esphome core functions used by the tas5805m component
+#include "esphome/core/component.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/preferences.h"
+
+namespace esphome {
+
+static uint32_t stub_micros = 0;
+
+uint32_t millis() { return stub_micros / 1000; }
+uint32_t micros() { return stub_micros; }
+void delay(uint32_t ms) { stub_micros += ms * 1000; }
+void delayMicroseconds(uint32_t us) { stub_micros += us; }
+void stub_set_micros(uint32_t us) { stub_micros = us; }
+void stub_advance_micros(uint32_t us) { stub_micros += us; }
+
+static ESPPreferences stub_preferences;
+ESPPreferences *global_preferences = &stub_preferences;
+
+static bool is_due(uint32_t now, uint32_t next) { return static_cast<int32_t>(now - next) >= 0; }
+
+static uint32_t scheduled_id = 0;
+
+// unnamed items are given unique names so they do not replace each other
+void Component::set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f) {
+  std::string key = name.empty() ? "\x01" + std::to_string(scheduled_id) : name;
+  this->timeouts_[key] = Scheduled{millis() + timeout, 0, std::move(f), scheduled_id++};
+}
+
+void Component::set_interval(const std::string &name, uint32_t interval, std::function<void()> &&f) {
+  std::string key = name.empty() ? "\x02" + std::to_string(scheduled_id) : name;
+  this->intervals_[key] = Scheduled{millis() + interval, interval, std::move(f), scheduled_id++};
+}
+
+// only items due when called are run, items scheduled by a callback run on a later call
+// as on the device, and an item cancelled or replaced by an earlier callback is skipped
+void Component::run_scheduler(uint32_t now) {
+  std::vector<std::pair<std::string, uint32_t>> due_timeouts;
+  for (auto &item : this->timeouts_) {
+    if (is_due(now, item.second.next)) due_timeouts.emplace_back(item.first, item.second.id);
+  }
+  std::vector<std::pair<std::string, uint32_t>> due_intervals;
+  for (auto &item : this->intervals_) {
+    if (is_due(now, item.second.next)) due_intervals.emplace_back(item.first, item.second.id);
+  }
+
+  for (auto &due : due_timeouts) {
+    auto it = this->timeouts_.find(due.first);
+    if ((it == this->timeouts_.end()) || (it->second.id != due.second)) continue;
+    auto f = std::move(it->second.f);
+    this->timeouts_.erase(it);
+    f();
+  }
+  for (auto &due : due_intervals) {
+    auto it = this->intervals_.find(due.first);
+    if ((it == this->intervals_.end()) || (it->second.id != due.second)) continue;
+    it->second.next = now + it->second.period;
+    auto f = it->second.f;
+    f();
+  }
+}
+
+void PollingComponent::start_poller() {
+  this->set_interval("update", this->get_update_interval(), [this]() { this->update(); });
+}
+
+}  // namespace esphome
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "esphome/core/hal.h"
+#include "mock_tas5805m_bus.h"
+#include "tas5805m/tas5805m.h"
+
+namespace esphome::tas5805m::testing {
+
+// a tas5805m component on a mock bus, driven by a virtual clock in 1ms loop iterations
+class Tas5805mHarness {
+ public:
+  Tas5805mHarness() {
+    stub_set_micros(0);
+    this->dac.set_i2c_bus(&this->bus);
+    this->dac.set_i2c_address(0x2D);
+    this->dac.set_enable_pin(&this->enable_pin);
+    this->dac.set_update_interval(1000);
+
+    // YAML defaults, as set by code generation
+    this->dac.config_analog_gain(-15.5);
+    this->dac.config_dac_mode(BTL);
+    this->dac.config_ignore_fault_mode(ExcludeIgnoreMode::CLOCK_FAULT);
+    this->dac.config_exclude_fault(ExcludeIgnoreMode::CLOCK_FAULT);
+    this->dac.config_mixer_mode(STEREO);
+    this->dac.config_modulation_mode(MOD_BD);
+    this->dac.config_switching_frequency(FSW_768KHZ);
+    this->dac.config_volume_max(24);
+    this->dac.config_volume_min(-103);
+  }
+
+  void setup() { this->dac.call_setup(); }
+
+  void run_for(uint32_t ms) {
+    for (uint32_t i = 0; i < ms; i++) {
+      stub_advance_micros(1000);
+      if (this->dac.is_loop_enabled()) this->dac.loop();
+      this->dac.run_scheduler(millis());
+    }
+  }
+
+  // boot with the refresh of mixer and eq settings complete and fault polling started
+  void boot() {
+    this->setup();
+    this->dac.refresh_settings();
+    this->run_for(6000);
+  }
+
+  MockTas5805mBus bus;
+  GPIOPin enable_pin;
+  Tas5805mComponent dac;
+};
+
+}  // namespace esphome::tas5805m::testing
@@ -0,0 +1,517 @@
+#include <gtest/gtest.h>
+
+#include "tas5805m/automation.h"
+#include "tas5805m/number/mixer_gain_number.h"
+#include "tas5805m/select/mixer_mode_select.h"
+#include "tas5805m_harness.h"
+
+namespace esphome::tas5805m::testing {
+
+static const uint8_t ADDRESS_DEVICE_CTRL_2_MUTE = 0x08;
+
+static std::vector<uint8_t> word_9_23(uint32_t value) {
+  return {(uint8_t)(value >> 24), (uint8_t)(value >> 16), (uint8_t)(value >> 8), (uint8_t)value};
+}
+
+static const uint32_t UNITY_9_23 = 0x00800000;  // 0dB
+
+class Tas5805mTest : public ::testing::Test {
+ protected:
+  std::vector<uint8_t> mixer_word(MixerPath path) {
+    return this->h.bus.get_bytes(TAS5805M_REG_BOOK_5, TAS5805M_REG_BOOK_5_MIXER_PAGE,
+                                 TAS5805M_REG_LEFT_TO_LEFT_GAIN + (path * 4), 4);
+  }
+
+  float mixer_gain_db(MixerPath path) {
+    std::vector<uint8_t> word = this->mixer_word(path);
+    int32_t value = (int32_t) encode_uint32(word[0], word[1], word[2], word[3]);
+    return 20.0f * log10f(value / 8388608.0f);
+  }
+
+  Tas5805mHarness h;
+};
+
+// setup
+
+TEST_F(Tas5805mTest, SetupConfiguresRegistersAndEntersPlay) {
+  h.setup();
+  EXPECT_FALSE(h.dac.is_failed());
+  EXPECT_TRUE(h.enable_pin.digital_read());
+  EXPECT_EQ(h.bus.get(TAS5805M_DEVICE_CTRL_2), CTRL_PLAY);
+  EXPECT_EQ(h.bus.get(TAS5805M_DEVICE_CTRL_1), 0x00);   // 768kHz, BTL, BD modulation
+  EXPECT_EQ(h.bus.get(TAS5805M_AGAIN), 0x1F);           // -15.5dB
+  EXPECT_EQ(h.bus.get(TAS5805M_DIG_VOL_CTRL), 0x30);    // 0dB
+  EXPECT_EQ(h.bus.get(TAS5805M_SAP_CTRL1), 0x02);       // I2S, 24 bit
+  EXPECT_EQ(h.bus.get(TAS5805M_SAP_CTRL2), 0x00);
+  EXPECT_EQ(h.bus.get(TAS5805M_DSP_MISC), TAS5805M_CTRL_EQ_ON);
+}
+
+TEST_F(Tas5805mTest, SetupFailsWithoutAcknowledge) {
+  h.bus.fail = true;
+  h.setup();
+  EXPECT_TRUE(h.dac.is_failed());
+}
+
+TEST_F(Tas5805mTest, TdmSlotSetsDataOffset) {
+  h.dac.config_serial_audio_port(FORMAT_TDM, WORD_LENGTH_32, 9);
+  h.setup();
+  EXPECT_EQ(h.bus.get(TAS5805M_SAP_CTRL1), (FORMAT_TDM << 4) | WORD_LENGTH_32 | TAS5805M_SAP_OFFSET_MSB);
+  EXPECT_EQ(h.bus.get(TAS5805M_SAP_CTRL2), (9 * 32) & 0xFF);
+}
+
+// loop driven refresh
+
+TEST_F(Tas5805mTest, RefreshWaitsForTrigger) {
+  h.setup();
+  h.run_for(500);
+  EXPECT_FALSE(h.dac.is_refresh_complete());
+  EXPECT_EQ(h.bus.writes_to(TAS5805M_REG_BOOK_5, TAS5805M_REG_BOOK_5_MIXER_PAGE, TAS5805M_REG_LEFT_TO_LEFT_GAIN), 0u);
+}
+
+TEST_F(Tas5805mTest, RefreshWritesMixerAndEqThenDisablesLoop) {
+  h.dac.set_eq_gain(BAND_1250HZ, 4);
+  h.setup();
+  h.dac.refresh_settings();
+  h.run_for(100);
+  EXPECT_TRUE(h.dac.is_refresh_complete());
+  h.run_for(1);
+  EXPECT_FALSE(h.dac.is_loop_enabled());
+  EXPECT_EQ(this->mixer_word(MIXER_LEFT_TO_LEFT), word_9_23(UNITY_9_23));
+  EXPECT_EQ(this->mixer_word(MIXER_RIGHT_TO_LEFT), word_9_23(0));
+
+  const RegisterSequenceEq* eq = &TAS5805M_EQ_REGISTERS[4 + TAS5805M_EQ_MAX_DB][BAND_1250HZ];
+  EXPECT_EQ(h.bus.get_bytes(TAS5805M_REG_BOOK_EQ, eq->page, eq->offset1, eq->bytes_in_block1),
+            std::vector<uint8_t>(eq->value, eq->value + eq->bytes_in_block1));
+  // control port selected again once eq gains are written
+  EXPECT_EQ(h.bus.book(), TAS5805M_REG_BOOK_CONTROL_PORT);
+  EXPECT_EQ(h.bus.page(), TAS5805M_REG_PAGE_ZERO);
+}
+
+TEST_F(Tas5805mTest, GroupMemberRefreshesAfterPrevious) {
+  Tas5805mHarness second;
+  h.dac.set_refresh_after(&second.dac);
+  h.setup();
+  second.setup();
+  h.dac.refresh_settings();
+  h.run_for(100);
+  EXPECT_FALSE(h.dac.is_refresh_complete());
+  second.dac.refresh_settings();
+  second.run_for(100);
+  h.run_for(100);
+  EXPECT_TRUE(h.dac.is_refresh_complete());
+}
+
+TEST_F(Tas5805mTest, GroupMemberRefreshesWhenPreviousNever) {
+  Tas5805mHarness second;
+  h.dac.set_refresh_after(&second.dac);
+  h.setup();
+  second.setup();
+  h.dac.refresh_settings();
+  h.run_for(4000);
+  EXPECT_FALSE(h.dac.is_refresh_complete());
+  h.run_for(2000);
+  EXPECT_TRUE(h.dac.is_refresh_complete());
+}
+
+TEST_F(Tas5805mTest, GroupMemberPollsOnlyInItsSlot) {
+  h.dac.set_fault_poll_offset(100);
+  h.boot();
+  for (uint32_t ms = 0; ms < 30000; ms++) {
+    // fault checks requested at any time are made straight away, later polls return to the slot
+    bool requested = ((ms % 7013) == 0);
+    if (requested) h.dac.request_fault_check();
+    uint32_t reads = h.bus.reads_from(0, 0, TAS5805M_POWER_STATE) + h.bus.reads_from(0, 0, TAS5805M_FS_MON);
+    h.run_for(1);
+    bool read = (h.bus.reads_from(0, 0, TAS5805M_POWER_STATE) + h.bus.reads_from(0, 0, TAS5805M_FS_MON) != reads);
+    if (requested) {
+      EXPECT_TRUE(read);
+    } else if (read) {
+      EXPECT_EQ(millis() % 250, 100u);
+    }
+  }
+}
+
+TEST_F(Tas5805mTest, GroupActionsReachEveryMember) {
+  Tas5805mHarness second;
+  h.boot();
+  second.boot();
+  Tas5805mGroup group;
+  group.add_amp(&h.dac);
+  group.add_amp(&second.dac);
+  FadeToAction<Tas5805mGroup> fade;
+  fade.set_parent(&group);
+  fade.set_volume(1.0f);
+  fade.set_duration(0);
+  fade.play_complex();
+  EXPECT_EQ(h.bus.get(TAS5805M_DIG_VOL_CTRL), 0);
+  EXPECT_EQ(second.bus.get(TAS5805M_DIG_VOL_CTRL), 0);
+  EXPECT_TRUE(group.set_balance(-1.0f));
+  EXPECT_EQ(h.bus.get_bytes(TAS5805M_REG_BOOK_5, TAS5805M_REG_BOOK_5_VOLUME_PAGE, TAS5805M_REG_RIGHT_VOLUME, 4),
+            second.bus.get_bytes(TAS5805M_REG_BOOK_5, TAS5805M_REG_BOOK_5_VOLUME_PAGE, TAS5805M_REG_RIGHT_VOLUME, 4));
+  EXPECT_NE(h.bus.get_bytes(TAS5805M_REG_BOOK_5, TAS5805M_REG_BOOK_5_VOLUME_PAGE, TAS5805M_REG_RIGHT_VOLUME, 4),
+            word_9_23(UNITY_9_23));
+}
+
+// volume mapping
+
+TEST_F(Tas5805mTest, VolumeMapsToDigitalVolumeRange) {
+  h.boot();
+  EXPECT_TRUE(h.dac.set_volume(1.0f));
+  EXPECT_EQ(h.bus.get(TAS5805M_DIG_VOL_CTRL), 0);       // +24dB
+  EXPECT_FLOAT_EQ(h.dac.volume(), 1.0f);
+  EXPECT_TRUE(h.dac.set_volume(0.0f));
+  EXPECT_EQ(h.bus.get(TAS5805M_DIG_VOL_CTRL), 254);     // -103dB
+  EXPECT_FLOAT_EQ(h.dac.volume(), 0.0f);
+  EXPECT_TRUE(h.dac.set_volume(2.0f));                  // clamped
+  EXPECT_EQ(h.bus.get(TAS5805M_DIG_VOL_CTRL), 0);
+}
+
+TEST_F(Tas5805mTest, VolumeRangeFollowsConfiguredLimits) {
+  h.dac.config_volume_max(0);
+  h.dac.config_volume_min(-60);
+  h.boot();
+  h.dac.set_volume(1.0f);
+  EXPECT_EQ(h.bus.get(TAS5805M_DIG_VOL_CTRL), 48);      // 0dB
+  h.dac.set_volume(0.0f);
+  EXPECT_EQ(h.bus.get(TAS5805M_DIG_VOL_CTRL), 168);     // -60dB
+}
+
+TEST_F(Tas5805mTest, VolumeReportedThroughSequenceAndDuck) {
+  h.boot();
+  h.dac.set_volume(0.5f);
+  float volume = h.dac.volume();
+  EXPECT_TRUE(h.dac.set_control_state(CTRL_HI_Z));
+  EXPECT_TRUE(h.dac.is_sequence_running());
+  EXPECT_EQ(h.bus.get(TAS5805M_DIG_VOL_CTRL), TAS5805M_DIGITAL_VOLUME_MUTE);
+  EXPECT_FLOAT_EQ(h.dac.volume(), volume);
+  h.run_for(200);
+  EXPECT_TRUE(h.dac.duck(-20.0f, 0, 0, 0));
+  h.run_for(100);
+  EXPECT_FLOAT_EQ(h.dac.volume(), volume);
+}
+
+TEST_F(Tas5805mTest, LongFadeSteppedNotWrapped) {
+  h.boot();
+  h.dac.set_volume(0.0f);
+  // just over 71 minutes, in us this wraps 32 bits to under 1ms
+  EXPECT_TRUE(h.dac.fade_to(1.0f, 4294968));
+  EXPECT_TRUE(h.dac.is_fading());
+  EXPECT_EQ(h.bus.get(TAS5805M_DIG_VOL_CTRL), 254);
+}
+
+TEST_F(Tas5805mTest, FadeUpRequestsFaultCheck) {
+  h.boot();
+  h.dac.set_volume(0.0f);
+  h.run_for(30000);   // fault polls backed off
+  uint32_t reads = h.bus.reads_from(0, 0, TAS5805M_POWER_STATE);
+  EXPECT_TRUE(h.dac.fade_to(1.0f, 0));
+  h.run_for(1);
+  EXPECT_GT(h.bus.reads_from(0, 0, TAS5805M_POWER_STATE), reads);
+}
+
+TEST_F(Tas5805mTest, MuteSetsMuteBitAfterSequence) {
+  h.boot();
+  EXPECT_TRUE(h.dac.set_mute_on());
+  h.run_for(200);
+  EXPECT_TRUE(h.dac.is_muted());
+  EXPECT_TRUE(h.bus.get(TAS5805M_DEVICE_CTRL_2) & ADDRESS_DEVICE_CTRL_2_MUTE);
+  EXPECT_TRUE(h.dac.set_mute_off());
+  h.run_for(200);
+  EXPECT_FALSE(h.bus.get(TAS5805M_DEVICE_CTRL_2) & ADDRESS_DEVICE_CTRL_2_MUTE);
+  EXPECT_EQ(h.bus.get(TAS5805M_DEVICE_CTRL_2) & TAS5805M_POWER_STATE_MASK, CTRL_PLAY);
+}
+
+// mixer modes
+
+TEST_F(Tas5805mTest, ConfiguredMixerModeWrittenAtRefresh) {
+  h.dac.config_mixer_mode(MONO);
+  h.boot();
+  for (uint8_t path = 0; path < 4; path++) {
+    EXPECT_NEAR(this->mixer_gain_db(static_cast<MixerPath>(path)), -6.0f, 0.01f) << MIXER_PATH_TEXT[path];
+  }
+}
+
+TEST_F(Tas5805mTest, MixerModesSetPathGains) {
+  h.boot();
+  struct { MixerMode mode; uint32_t words[4]; } cases[] = {
+    {STEREO,         {UNITY_9_23, 0, 0, UNITY_9_23}},
+    {STEREO_INVERSE, {0, UNITY_9_23, UNITY_9_23, 0}},
+    {LEFT,           {UNITY_9_23, 0, UNITY_9_23, 0}},
+    {RIGHT,          {0, UNITY_9_23, 0, UNITY_9_23}},
+  };
+  for (auto &c : cases) {
+    EXPECT_TRUE(h.dac.set_mixer_mode(c.mode));
+    h.run_for(500);
+    EXPECT_EQ(h.dac.mixer_mode(), c.mode);
+    for (uint8_t path = 0; path < 4; path++) {
+      EXPECT_EQ(this->mixer_word(static_cast<MixerPath>(path)), word_9_23(c.words[path]))
+          << MIXER_MODE_TEXT[c.mode] << " " << MIXER_PATH_TEXT[path];
+    }
+  }
+}
+
+TEST_F(Tas5805mTest, InvalidMixerModeRejected) {
+  h.boot();
+  EXPECT_FALSE(h.dac.set_mixer_mode(static_cast<MixerMode>(LEFT + 1)));
+  EXPECT_EQ(h.dac.mixer_mode(), STEREO);
+}
+
+TEST_F(Tas5805mTest, MixerEntitiesFollowChangesFromElsewhere) {
+  MixerModeSelect mode_select;
+  mode_select.traits_set_options({"STEREO", "STEREO_INVERSE", "MONO", "RIGHT", "LEFT"});
+  mode_select.set_parent(&h.dac);
+  MixerGainNumber right_to_left;
+  right_to_left.set_mixer_path(MIXER_RIGHT_TO_LEFT);
+  right_to_left.set_parent(&h.dac);
+  h.boot();
+  mode_select.setup();
+  right_to_left.setup();
+  EXPECT_EQ(mode_select.state, "STEREO");
+  EXPECT_FLOAT_EQ(right_to_left.state, TAS5805M_MIN_MIXER_GAIN_DB);
+
+  h.dac.set_mixer_mode(MONO);
+  EXPECT_EQ(mode_select.state, "MONO");
+  EXPECT_FLOAT_EQ(right_to_left.state, -6.0f);
+
+  h.dac.set_mixer_gain(MIXER_RIGHT_TO_LEFT, -3.0f);
+  EXPECT_FLOAT_EQ(right_to_left.state, -3.0f);
+}
+
+// eq writes
+
+TEST_F(Tas5805mTest, EveryEqGainWritesTableCoefficients) {
+  h.boot();
+  for (int8_t gain = TAS5805M_EQ_MIN_DB; gain <= TAS5805M_EQ_MAX_DB; gain++) {
+    for (uint8_t band = 0; band < NUMBER_EQ_BANDS; band++) {
+      ASSERT_TRUE(h.dac.set_eq_gain(band, gain));
+      const RegisterSequenceEq* eq = &TAS5805M_EQ_REGISTERS[gain + TAS5805M_EQ_MAX_DB][band];
+      std::vector<uint8_t> written = h.bus.get_bytes(TAS5805M_REG_BOOK_EQ, eq->page, eq->offset1, eq->bytes_in_block1);
+      uint8_t bytes_in_block2 = COEFFICENTS_PER_EQ_BAND - eq->bytes_in_block1;
+      std::vector<uint8_t> block2 = h.bus.get_bytes(TAS5805M_REG_BOOK_EQ, eq->page + 1, eq->offset2, bytes_in_block2);
+      written.insert(written.end(), block2.begin(), block2.end());
+      ASSERT_EQ(written, std::vector<uint8_t>(eq->value, eq->value + COEFFICENTS_PER_EQ_BAND))
+          << "band " << (int) band << " gain " << (int) gain;
+    }
+  }
+}
+
+TEST_F(Tas5805mTest, DeepSleepReplayRetriesFailedEqBand) {
+  h.dac.set_eq_gain(BAND_20HZ, 4);
+  h.boot();
+  h.dac.set_control_state(CTRL_DEEP_SLEEP);
+  h.run_for(200);
+  const RegisterSequenceEq* eq = &TAS5805M_EQ_REGISTERS[4 + TAS5805M_EQ_MAX_DB][BAND_20HZ];
+  std::vector<uint8_t> coefficients(eq->value, eq->value + eq->bytes_in_block1);
+  for (uint8_t i = 0; i < eq->bytes_in_block1; i++) h.bus.set(TAS5805M_REG_BOOK_EQ, eq->page, eq->offset1 + i, 0);
+
+  h.bus.fail_writes_to(TAS5805M_REG_BOOK_EQ, eq->page, eq->offset1);
+  h.dac.set_control_state(CTRL_PLAY);
+  h.run_for(200);
+  h.bus.reset_write_failures();
+  EXPECT_NE(h.bus.get_bytes(TAS5805M_REG_BOOK_EQ, eq->page, eq->offset1, eq->bytes_in_block1), coefficients);
+
+  // the band is still lost so the next sequence replays it
+  h.dac.set_control_state(CTRL_PLAY);
+  h.run_for(200);
+  EXPECT_EQ(h.bus.get_bytes(TAS5805M_REG_BOOK_EQ, eq->page, eq->offset1, eq->bytes_in_block1), coefficients);
+  EXPECT_EQ(h.bus.get(TAS5805M_DEVICE_CTRL_2) & TAS5805M_POWER_STATE_MASK, CTRL_PLAY);
+}
+
+TEST_F(Tas5805mTest, InvalidEqGainRejected) {
+  h.boot();
+  h.bus.reset_counters();
+  EXPECT_FALSE(h.dac.set_eq_gain(NUMBER_EQ_BANDS, 0));
+  EXPECT_FALSE(h.dac.set_eq_gain(0, TAS5805M_EQ_MAX_DB + 1));
+  EXPECT_EQ(h.bus.write_transactions, 0u);
+}
+
+TEST_F(Tas5805mTest, EqGainChangesOutputLatency) {
+  h.boot();
+  float flat = h.dac.output_latency();
+  EXPECT_NEAR(flat, 1.0f, 0.001f);   // pipeline only at 48kHz
+  h.dac.set_eq_gain(BAND_800HZ, 6);
+  // group delay at 1kHz of the +6dB 800Hz coefficients
+  EXPECT_NEAR(h.dac.output_latency() - flat, 0.104f, 0.001f);
+  h.dac.set_eq_gain(BAND_800HZ, 0);
+  EXPECT_NEAR(h.dac.output_latency(), flat, 0.001f);
+}
+
+TEST_F(Tas5805mTest, StagedChangesCommittedWithoutVolumeSideEffects) {
+  h.boot();
+  EXPECT_TRUE(h.dac.fade_to(0.0f, 10000));
+  h.run_for(100);
+  h.bus.reset_counters();
+  h.dac.stage_volume(1.0f);
+  EXPECT_TRUE(h.dac.stage_eq_gain(BAND_1250HZ, 4));
+  EXPECT_TRUE(h.dac.commit_staged_at(1));   // long passed, committed now
+  EXPECT_FALSE(h.dac.is_commit_pending());
+  EXPECT_EQ(h.bus.get(TAS5805M_DIG_VOL_CTRL), 0);
+  const RegisterSequenceEq* eq = &TAS5805M_EQ_REGISTERS[4 + TAS5805M_EQ_MAX_DB][BAND_1250HZ];
+  EXPECT_EQ(h.bus.get_bytes(TAS5805M_REG_BOOK_EQ, eq->page, eq->offset1, eq->bytes_in_block1),
+            std::vector<uint8_t>(eq->value, eq->value + eq->bytes_in_block1));
+  EXPECT_EQ(h.bus.book(), TAS5805M_REG_BOOK_CONTROL_PORT);
+  EXPECT_EQ(h.bus.page(), TAS5805M_REG_PAGE_ZERO);
+  // the fade is left running and the volume ramp unchanged
+  EXPECT_TRUE(h.dac.is_fading());
+  EXPECT_EQ(h.bus.writes_to(0, 0, TAS5805M_DIG_VOL_CTRL2), 0u);
+}
+
+TEST_F(Tas5805mTest, PipelineLatencyFollowsConfig) {
+  h.dac.config_pipeline_latency(96);
+  h.boot();
+  EXPECT_NEAR(h.dac.output_latency(), 2.0f, 0.001f);   // 96 samples at 48kHz
+}
+
+// fault handling
+
+TEST_F(Tas5805mTest, FaultSensorsPublishedOnChange) {
+  binary_sensor::BinarySensor have_fault, pvdd_under_voltage;
+  h.dac.set_have_fault_binary_sensor(&have_fault);
+  h.dac.set_pvdd_under_voltage_fault_binary_sensor(&pvdd_under_voltage);
+  h.boot();
+  EXPECT_TRUE(have_fault.has_state());
+  EXPECT_FALSE(have_fault.state);
+
+  h.bus.set(TAS5805M_GLOBAL_FAULT1, 0x01);
+  h.dac.request_fault_check();
+  h.run_for(20);
+  EXPECT_TRUE(have_fault.state);
+  EXPECT_TRUE(pvdd_under_voltage.state);
+  EXPECT_EQ(h.dac.fault_event_count(), 1);
+
+  // cleared at the next poll and published as clear
+  h.run_for(1000);
+  EXPECT_EQ(h.bus.get(TAS5805M_GLOBAL_FAULT1), 0);
+  EXPECT_FALSE(pvdd_under_voltage.state);
+  EXPECT_FALSE(have_fault.state);
+}
+
+TEST_F(Tas5805mTest, FaultShutdownRestoresRequestedState) {
+  h.boot();
+  h.bus.set(TAS5805M_GLOBAL_FAULT1, 0x01);   // pvdd under voltage
+  h.bus.set(TAS5805M_POWER_STATE, CTRL_HI_Z);
+  h.dac.request_fault_check();
+  h.run_for(20);
+  EXPECT_EQ(h.dac.power_state(), CTRL_HI_Z);
+
+  // fault cleared at the next poll, then play is written again
+  h.run_for(2000);
+  EXPECT_EQ(h.bus.get(TAS5805M_GLOBAL_FAULT1), 0);
+  EXPECT_EQ(h.bus.get(TAS5805M_POWER_STATE), CTRL_PLAY);
+  EXPECT_EQ(h.dac.power_state(), CTRL_PLAY);
+
+  h.dac.set_mute_on();
+  h.run_for(200);
+  h.dac.set_mute_off();
+  h.run_for(200);
+  EXPECT_EQ(h.bus.get(TAS5805M_DEVICE_CTRL_2), CTRL_PLAY);
+}
+
+TEST_F(Tas5805mTest, ChannelFaultRecoversThroughHiZ) {
+  h.boot();
+  h.bus.set(TAS5805M_CHAN_FAULT, 0x01);   // right over current
+  h.dac.request_fault_check();
+  h.run_for(200);
+  EXPECT_EQ(h.dac.fault_recovery_state(), RECOVERY_BACKOFF);
+  EXPECT_EQ(h.bus.get(TAS5805M_DEVICE_CTRL_2) & TAS5805M_POWER_STATE_MASK, CTRL_HI_Z);
+
+  h.run_for(3000);
+  EXPECT_EQ(h.bus.get(TAS5805M_CHAN_FAULT), 0);
+  EXPECT_EQ(h.bus.get(TAS5805M_DEVICE_CTRL_2) & TAS5805M_POWER_STATE_MASK, CTRL_PLAY);
+}
+
+TEST_F(Tas5805mTest, RepeatedChannelFaultLocksOut) {
+  h.dac.config_fault_recovery(100, 2, 60000);
+  h.boot();
+  for (int i = 0; i < 4; i++) {
+    h.bus.set(TAS5805M_CHAN_FAULT, 0x04);   // right dc
+    h.dac.request_fault_check();
+    h.run_for(1000);
+  }
+  EXPECT_EQ(h.dac.fault_recovery_state(), RECOVERY_LOCKOUT);
+  EXPECT_EQ(h.bus.get(TAS5805M_DEVICE_CTRL_2) & TAS5805M_POWER_STATE_MASK, CTRL_HI_Z);
+  h.dac.reset_fault_recovery();
+  EXPECT_EQ(h.dac.fault_recovery_state(), RECOVERY_IDLE);
+  EXPECT_EQ(h.bus.get(TAS5805M_CHAN_FAULT), 0);
+
+  // the latched fault is not read again, so play holds
+  h.dac.set_control_state(CTRL_PLAY);
+  h.run_for(5000);
+  EXPECT_EQ(h.dac.fault_recovery_state(), RECOVERY_IDLE);
+  EXPECT_EQ(h.bus.get(TAS5805M_DEVICE_CTRL_2) & TAS5805M_POWER_STATE_MASK, CTRL_PLAY);
+}
+
+TEST_F(Tas5805mTest, OverTemperatureWarningStartsFoldback) {
+  h.boot();
+  h.bus.set(TAS5805M_OT_WARNING, 0x04);
+  h.dac.request_fault_check();
+  h.run_for(20);
+  EXPECT_FLOAT_EQ(h.dac.thermal_foldback(), 3.0f);
+}
+
+TEST_F(Tas5805mTest, FoldbackHoldsWarningBetweenSlowPolls) {
+  // fault polls are further apart than foldback steps
+  h.dac.config_fault_poll_interval(3000, 10000);
+  h.dac.config_thermal_foldback(3.0f, 12.0f, 1000, 60000);
+  h.boot();
+  h.bus.set(TAS5805M_OT_WARNING, 0x04);
+  h.dac.request_fault_check();
+  h.run_for(10);
+  // warning latches again after every clear, as it does while the device stays hot
+  for (int i = 0; i < 25; i++) {
+    h.bus.set(TAS5805M_OT_WARNING, 0x04);
+    h.run_for(100);
+  }
+  EXPECT_FLOAT_EQ(h.dac.thermal_foldback(), 9.0f);
+}
+
+TEST_F(Tas5805mTest, FaultPollBacksOffWhenClean) {
+  h.dac.config_fault_poll_interval(250, 10000);
+  h.boot();
+  h.bus.reset_counters();
+  h.run_for(60000);
+  uint32_t clean_reads = h.bus.read_transactions;
+  // doubling from 250ms reaches 10s within six polls, so a minute is well under 60 polls
+  EXPECT_LT(clean_reads, 30u);
+}
+
+TEST_F(Tas5805mTest, FaultPollBacksOffWithIgnoredClockFault) {
+  // default ignore_fault: CLOCK_FAULT, a clock that stays missing is one glitch
+  h.bus.clock_present = false;
+  h.boot();
+  h.bus.reset_counters();
+  h.run_for(50000);
+  EXPECT_EQ(h.dac.clock_faults_per_minute(), 1);
+  EXPECT_LT(h.bus.read_transactions, 25u);
+}
+
+TEST_F(Tas5805mTest, EveryIgnoredClockGlitchCounted) {
+  h.boot();
+  for (int i = 0; i < 3; i++) {
+    h.bus.clock_present = false;
+    h.dac.request_fault_check();
+    h.run_for(1000);
+    h.bus.clock_present = true;
+    h.run_for(2000);
+  }
+  EXPECT_EQ(h.dac.clock_faults_per_minute(), 3);
+  EXPECT_EQ(h.dac.times_faults_cleared(), 0u);
+}
+
+TEST_F(Tas5805mTest, FaultPinRequestsImmediateCheck) {
+  InternalGPIOPin fault_pin;
+  fault_pin.digital_write(true);
+  h.dac.set_fault_pin(&fault_pin);
+  binary_sensor::BinarySensor clock_fault;
+  h.dac.set_clock_fault_binary_sensor(&clock_fault);
+  h.boot();
+  h.run_for(20000);
+
+  h.bus.set(TAS5805M_GLOBAL_FAULT1, 0x04);
+  fault_pin.digital_write(false);
+  fault_pin.fire_interrupt();
+  h.run_for(20);
+  EXPECT_TRUE(clock_fault.state);
+}
+
+}  // namespace esphome::tas5805m::testing